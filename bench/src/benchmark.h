@@ -0,0 +1,52 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "KitsuneEngine/core/board.h"
+
+using BenchmarkArgs = std::vector<std::string>;
+
+using PerftFunction = uint64_t ( * )( const Board &board, const CastleMask &castleMask, uint8_t depth, bool bulk );
+
+struct SuiteResult {
+	uint64_t m_Nodes = 0;
+	uint64_t m_Microseconds = 0;
+	uint32_t m_Mismatches = 0;
+
+	[[nodiscard]]
+	uint64_t GetNps() const {
+		return m_Nodes * 1000000 / ( m_Microseconds + 1 );
+	}
+};
+
+[[nodiscard]]
+std::vector<std::string> SplitString( const std::string &str, char delimiter );
+
+[[nodiscard]]
+uint32_t GetIntArgument( const BenchmarkArgs &args, size_t index, uint32_t defaultValue );
+
+// Runs every position of a "fen ;D1 n ;D2 n ..." suite at the deepest listed depth not exceeding maxDepth and checks
+// the node counts against the expected ones.
+[[nodiscard]]
+SuiteResult RunPerftSuite( const std::string *suite, size_t count, uint8_t maxDepth, PerftFunction perft );
+
+void RunPerftBenchmark( const BenchmarkArgs &args );
+
+void RunSliderBenchmark( const BenchmarkArgs &args );
+
+void RunTablesBenchmark( const BenchmarkArgs &args );
+
+void RunMovePickerBenchmark( const BenchmarkArgs &args );
+
+void RunSmpBenchmark( const BenchmarkArgs &args );
+
+void RunNnueBenchmark( const BenchmarkArgs &args );
+
+void RunPawnHashBenchmark( const BenchmarkArgs &args );
+
+void RunBookBenchmark( const BenchmarkArgs &args );
+
+void RunMicroBenchmark( const BenchmarkArgs &args );
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "benchmark.h"
+#include "KitsuneEngine/book/polyglot_book.h"
+
+static constexpr uint32_t BOOK_BENCH_LOOKUPS = 1000000;
+static constexpr uint32_t BOOK_BENCH_POSITIONS = 1000000;
+
+// Sorted random keys with one to three moves each, about the shape of a real book.
+static void WriteRandomBook( const std::string &path, const uint32_t positions ) {
+	std::mt19937_64 random( 0x424F4F4B );
+	std::vector<uint64_t> keys( positions );
+	for ( uint64_t &key : keys ) {
+		key = random();
+	}
+	std::ranges::sort( keys );
+
+	std::ofstream file( path, std::ios::binary | std::ios::trunc );
+	for ( const uint64_t key : keys ) {
+		for ( uint64_t move = 0; move <= key % 3; move++ ) {
+			for ( int i = 7; i >= 0; i-- ) {
+				file.put( static_cast<char>(key >> 8 * i & 0xFF) );
+			}
+			for ( int i = 0; i < 8; i++ ) {
+				file.put( static_cast<char>(i == 3 ? move + 1 : 0) );
+			}
+		}
+	}
+}
+
+// Compares opening the mapped book and probing it in place with reading the whole file, which is what the lookups
+// would cost up front if the book were parsed instead.
+void RunBookBenchmark( const BenchmarkArgs &args ) {
+	std::string path;
+	if ( !args.empty() ) {
+		path = args[0];
+	} else {
+		path = ( std::filesystem::temp_directory_path() / "kitsune_bench_book.bin" ).string();
+		WriteRandomBook( path, BOOK_BENCH_POSITIONS );
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	PolyglotBook book;
+	if ( !book.Open( path ) ) {
+		std::cout << "Could not open book: " << path << std::endl;
+		return;
+	}
+	const auto openMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start ).count();
+
+	start = std::chrono::steady_clock::now();
+	std::ifstream file( path, std::ios::binary );
+	const std::vector<char> contents( ( std::istreambuf_iterator( file ) ), std::istreambuf_iterator<char>() );
+	const auto readMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start ).count();
+
+	std::cout << std::format( "Book: {}, {} entries\nOpen: {} us mapped, {} us to read the whole file\n\n",
+	                          args.empty() ? "random" : path, book.GetEntryCount(), openMicroseconds, readMicroseconds );
+	std::cout << std::format( "{:<8} {:>14} {:>12} {:>12}\n", "Keys", "Lookups/s", "ns/lookup", "Found" );
+
+	std::mt19937_64 random( 1 );
+	for ( const bool hits : { true, false } ) {
+		std::vector<uint64_t> keys( BOOK_BENCH_LOOKUPS );
+		for ( uint64_t &key : keys ) {
+			key = hits ? book.GetEntry( random() % book.GetEntryCount() ).m_Key : random();
+		}
+
+		SuiteResult result{ };
+		uint64_t found = 0;
+		start = std::chrono::steady_clock::now();
+		for ( const uint64_t key : keys ) {
+			const auto [first, last] = book.FindEntries( key );
+			found += last - first;
+		}
+		result.m_Nodes = keys.size();
+		result.m_Microseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - start ).count();
+
+		std::cout << std::format( "{:<8} {:>14} {:>12.1f} {:>12}\n", hits ? "hits" : "misses", result.GetNps(),
+		                          1000.0 * result.m_Microseconds / result.m_Nodes, found );
+	}
+
+	book.Close();
+	if ( args.empty() ) {
+		std::filesystem::remove( path );
+	}
+}
@@ -0,0 +1,45 @@
+#include <iostream>
+#include <string_view>
+
+#include "benchmark.h"
+
+struct BenchmarkEntry {
+	std::string_view m_Name;
+	std::string_view m_Usage;
+	void ( *m_Function )( const BenchmarkArgs &args );
+};
+
+static constexpr BenchmarkEntry BENCHMARKS[]{
+	{ "perft", "perft [depth]   copy-make vs make/unmake perft on the standard and FRC suites", RunPerftBenchmark },
+	{ "sliders", "sliders [depth] magic vs PEXT slider lookups, shows which one the CPU check picked", RunSliderBenchmark },
+	{ "tables", "tables [runs]   time to build the slider attack tables for each lookup layout", RunTablesBenchmark },
+	{ "picker", "picker [depth]  staged MovePicker vs eager generation in a material alpha-beta", RunMovePickerBenchmark },
+	{ "smp", "smp [threads] [ms] Lazy SMP nps scaling from 1 thread up to the given count", RunSmpBenchmark },
+	{ "nnue", "nnue [file]     NNUE evals per second for each kernel and accumulator rows per search node", RunNnueBenchmark },
+	{ "pawns", "pawns [depth]   PSQT evals per second with and without the pawn hash table, and its hit rate in search", RunPawnHashBenchmark },
+	{ "book", "book [file]     Polyglot lookups per second on a memory-mapped book, a random one without a file", RunBookBenchmark },
+	{ "micro", "micro [filter]  ns/op and cycles/op of core primitives, optionally only the names containing filter", RunMicroBenchmark },
+};
+
+int main( const int argc, char **argv ) {
+	if ( argc < 2 ) {
+		std::cout << "Usage: Kitsune-Bench <benchmark> [args]\n\nBenchmarks:\n";
+		for ( const auto &benchmark : BENCHMARKS ) {
+			std::cout << "   " << benchmark.m_Usage << "\n";
+		}
+		return 0;
+	}
+
+	const std::string_view name = argv[1];
+	const BenchmarkArgs args( argv + 2, argv + argc );
+
+	for ( const auto &benchmark : BENCHMARKS ) {
+		if ( benchmark.m_Name == name ) {
+			benchmark.m_Function( args );
+			return 0;
+		}
+	}
+
+	std::cout << "Unknown benchmark: " << name << std::endl;
+	return 1;
+}
@@ -0,0 +1,259 @@
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <algorithm>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "benchmark.h"
+#include "perft_suites.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/core/attacks/attacks.h"
+#include "KitsuneEngine/core/attacks/pin_mask.h"
+#include "KitsuneEngine/eval/evaluation.h"
+
+// Inputs are cycled through so the branch predictor and caches see a realistic mix instead of one repeated call.
+static constexpr uint32_t INPUT_COUNT = 4096;
+static constexpr uint32_t BATCH_SIZE = 4096;
+static constexpr uint32_t MAX_BATCHES = 2000;
+static constexpr auto MIN_DURATION = std::chrono::milliseconds( 100 );
+
+struct MoveSample {
+	Board m_Board;
+	CastleMask m_CastleMask;
+	Move m_Move;
+};
+
+static uint64_t ReadCycles() {
+#if defined(_MSC_VER)
+	return __rdtsc();
+#else
+	return __builtin_ia32_rdtsc();
+#endif
+}
+
+template<typename T>
+static void DoNotOptimize( const T &value ) {
+#if defined(_MSC_VER)
+	static_cast<void>(*reinterpret_cast<const volatile char*>(&value));
+	_ReadWriteBarrier();
+#else
+	asm volatile( "" : : "g"( &value ) : "memory" );
+#endif
+}
+
+// Times batches of calls and keeps the fastest batch, which filters out interrupts and frequency ramp-up.
+template<typename Function>
+static void Measure( const std::string_view name, const std::string_view filter, Function &&function ) {
+	if ( !filter.empty() && name.find( filter ) == std::string_view::npos ) {
+		return;
+	}
+
+	double bestNanoseconds = 1e30;
+	double bestCycles = 1e30;
+	uint32_t index = 0;
+
+	const auto end = std::chrono::steady_clock::now() + MIN_DURATION;
+	for ( uint32_t batch = 0; batch < MAX_BATCHES && ( batch < 10 || std::chrono::steady_clock::now() < end ); batch++ ) {
+		const auto start = std::chrono::steady_clock::now();
+		const uint64_t startCycles = ReadCycles();
+
+		for ( uint32_t i = 0; i < BATCH_SIZE; i++ ) {
+			function( index );
+			index = ( index + 1 ) % INPUT_COUNT;
+		}
+
+		const uint64_t cycles = ReadCycles() - startCycles;
+		const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - start ).count();
+
+		bestNanoseconds = std::min( bestNanoseconds, static_cast<double>(nanoseconds) / BATCH_SIZE );
+		bestCycles = std::min( bestCycles, static_cast<double>(cycles) / BATCH_SIZE );
+	}
+
+	std::cout << std::format( "{:<32} {:>10.2f} {:>10.1f} {:>14.0f}\n", name, bestNanoseconds, bestCycles,
+	                          1e9 / bestNanoseconds );
+}
+
+static std::vector<std::string> LoadFens() {
+	std::vector<std::string> fens;
+	const auto load = [&fens]( const std::string *suite, const size_t count ) {
+		for ( size_t i = 0; i < count; i++ ) {
+			fens.push_back( SplitString( suite[i], ';' )[0] );
+		}
+	};
+
+	load( STANDARD_SUITE, std::size( STANDARD_SUITE ) );
+	load( FRC_SUITE, std::size( FRC_SUITE ) );
+	load( EN_PASSANT_SUITE, std::size( EN_PASSANT_SUITE ) );
+	return fens;
+}
+
+// Collects the legal moves of the suite positions and their children, so every move flag has samples.
+static std::vector<MoveSample> CollectMoves( const std::vector<Board> &boards, const MoveFlag flag ) {
+	std::vector<MoveSample> samples;
+
+	const auto collect = [&samples, flag]( const Board &board, const CastleMask &castleMask ) {
+		Move moves[MAX_MOVES];
+		const uint8_t count = MoveGenerator( board, castleMask ).GenerateMoves<MoveGenMode::ALL>( moves );
+		for ( uint8_t i = 0; i < count; i++ ) {
+			// Promotions are grouped by whether they capture, the piece type does not change the work done.
+			const MoveFlag moveFlag = moves[i].IsPromotion()
+				                          ? static_cast<MoveFlag>(moves[i].GetFlag() & KNIGHT_PROMOTION_CAPTURE_FLAG)
+				                          : moves[i].GetFlag();
+			if ( moveFlag == flag ) {
+				samples.push_back( { board, castleMask, moves[i] } );
+			}
+		}
+	};
+
+	for ( const Board &board : boards ) {
+		const CastleMask castleMask = board.GenerateCastleMask();
+		Move moves[MAX_MOVES];
+		const uint8_t count = MoveGenerator( board, castleMask ).GenerateMoves<MoveGenMode::ALL>( moves );
+
+		collect( board, castleMask );
+		for ( uint8_t i = 0; i < count; i++ ) {
+			Board child = board;
+			child.MakeMove( moves[i], castleMask );
+			collect( child, castleMask );
+		}
+	}
+
+	return samples;
+}
+
+static void MeasureSliders( const std::string_view filter ) {
+	std::mt19937_64 random( 0x4B495453554E45ull );
+	std::vector<Square> squares( INPUT_COUNT );
+	std::vector<Bitboard> occupancies( INPUT_COUNT );
+	for ( uint32_t i = 0; i < INPUT_COUNT; i++ ) {
+		squares[i] = static_cast<uint8_t>(random() % 64);
+		occupancies[i] = random() & random();
+	}
+
+	const SliderLookup selected = Attacks::GetSliderLookup();
+	for ( const SliderLookup lookup : { SliderLookup::MAGIC, SliderLookup::PEXT } ) {
+		if ( !Attacks::SetSliderLookup( lookup ) ) {
+			continue;
+		}
+
+		const std::string suffix = lookup == SliderLookup::PEXT ? "PEXT" : "magic";
+		Measure( std::format( "GetRookAttacks ({})", suffix ), filter, [&]( const uint32_t i ) {
+			DoNotOptimize( Attacks::GetRookAttacks( squares[i], occupancies[i] ) );
+		} );
+		Measure( std::format( "GetBishopAttacks ({})", suffix ), filter, [&]( const uint32_t i ) {
+			DoNotOptimize( Attacks::GetBishopAttacks( squares[i], occupancies[i] ) );
+		} );
+	}
+
+	Attacks::SetSliderLookup( selected );
+}
+
+void RunMicroBenchmark( const BenchmarkArgs &args ) {
+	const std::string filter = args.empty() ? "" : args[0];
+
+	std::cout << std::format( "Sliders: {}, cycles are TSC reference cycles\n\n", Attacks::GetSliderLookupName() );
+	std::cout << std::format( "{:<32} {:>10} {:>10} {:>14}\n", "Benchmark", "ns/op", "cycles/op", "ops/s" );
+
+	MeasureSliders( filter );
+
+	const std::vector<std::string> suiteFens = LoadFens();
+	std::vector<Board> boards;
+	for ( const auto &fen : suiteFens ) {
+		boards.emplace_back( FEN( fen ) );
+	}
+
+	std::vector<Board> inputs( INPUT_COUNT );
+	std::vector<CastleMask> castleMasks( INPUT_COUNT );
+	std::vector<std::string> fens( INPUT_COUNT );
+	for ( uint32_t i = 0; i < INPUT_COUNT; i++ ) {
+		inputs[i] = boards[i % boards.size()];
+		castleMasks[i] = inputs[i].GenerateCastleMask();
+		fens[i] = suiteFens[i % suiteFens.size()];
+	}
+
+	Measure( "PinMask", filter, [&]( const uint32_t i ) {
+		DoNotOptimize( PinMask( inputs[i], inputs[i].GetSideToMove() ) );
+	} );
+	Measure( "GenerateAttackMap", filter, [&]( const uint32_t i ) {
+		DoNotOptimize( Attacks::GenerateAttackMap( inputs[i], inputs[i].GetSideToMove() ) );
+	} );
+	Measure( "MoveGenerator construction", filter, [&]( const uint32_t i ) {
+		const auto generator = MoveGenerator( inputs[i], castleMasks[i] );
+		DoNotOptimize( generator );
+	} );
+	Measure( "MoveGenerator ALL", filter, [&]( const uint32_t i ) {
+		Move moves[MAX_MOVES];
+		DoNotOptimize( MoveGenerator( inputs[i], castleMasks[i] ).GenerateMoves<MoveGenMode::ALL>( moves ) );
+		DoNotOptimize( moves );
+	} );
+	Measure( "MoveGenerator NOISY", filter, [&]( const uint32_t i ) {
+		Move moves[MAX_MOVES];
+		DoNotOptimize( MoveGenerator( inputs[i], castleMasks[i] ).GenerateMoves<MoveGenMode::NOISY>( moves ) );
+		DoNotOptimize( moves );
+	} );
+	Measure( "MoveGenerator CountMoves", filter, [&]( const uint32_t i ) {
+		DoNotOptimize( MoveGenerator( inputs[i], castleMasks[i] ).CountMoves<MoveGenMode::ALL>() );
+	} );
+	Measure( "Evaluate (PSQT)", filter, [&]( const uint32_t i ) {
+		DoNotOptimize( Evaluation::Evaluate( inputs[i] ) );
+	} );
+	Measure( "ComputePsqtScore", filter, [&]( const uint32_t i ) {
+		DoNotOptimize( inputs[i].ComputePsqtScore() );
+	} );
+
+	static constexpr std::pair<MoveFlag, std::string_view> FLAGS[]{
+		{ QUIET_MOVE_FLAG, "quiet" },
+		{ DOUBLE_PUSH_FLAG, "double push" },
+		{ KING_SIDE_CASTLE_FLAG, "king side castle" },
+		{ QUEEN_SIDE_CASTLE_FLAG, "queen side castle" },
+		{ CAPTURE_FLAG, "capture" },
+		{ EN_PASSANT_FLAG, "en passant" },
+		{ KNIGHT_PROMOTION_FLAG, "promotion" },
+		{ KNIGHT_PROMOTION_CAPTURE_FLAG, "promotion capture" },
+	};
+
+	for ( const auto &[flag, flagName] : FLAGS ) {
+		std::vector<MoveSample> samples = CollectMoves( boards, flag );
+		if ( samples.empty() ) {
+			continue;
+		}
+
+		Measure( std::format( "Make+Unmake {}", flagName ), filter, [&]( const uint32_t i ) {
+			MoveSample &sample = samples[i % samples.size()];
+			MoveUndo undo;
+			sample.m_Board.MakeMove( sample.m_Move, sample.m_CastleMask, undo );
+			DoNotOptimize( sample.m_Board );
+			sample.m_Board.UnmakeMove( sample.m_Move, undo );
+		} );
+	}
+
+	// A quiet move still has to see whether its destination is attacked, a capture usually goes further.
+	const std::vector<MoveSample> captures = CollectMoves( boards, CAPTURE_FLAG );
+	const std::vector<MoveSample> quiets = CollectMoves( boards, QUIET_MOVE_FLAG );
+	Measure( "See capture", filter, [&]( const uint32_t i ) {
+		const MoveSample &sample = captures[i % captures.size()];
+		DoNotOptimize( sample.m_Board.See( sample.m_Move ) );
+	} );
+	Measure( "SeeGe capture", filter, [&]( const uint32_t i ) {
+		const MoveSample &sample = captures[i % captures.size()];
+		DoNotOptimize( sample.m_Board.SeeGe( sample.m_Move, 0 ) );
+	} );
+	Measure( "SeeGe quiet", filter, [&]( const uint32_t i ) {
+		const MoveSample &sample = quiets[i % quiets.size()];
+		DoNotOptimize( sample.m_Board.SeeGe( sample.m_Move, 0 ) );
+	} );
+
+	Measure( "FEN parse", filter, [&]( const uint32_t i ) {
+		DoNotOptimize( FEN( fens[i] ) );
+	} );
+	Measure( "Board from FEN", filter, [&]( const uint32_t i ) {
+		DoNotOptimize( Board( FEN( fens[i] ) ) );
+	} );
+}
@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <format>
+#include <iostream>
+
+#include "benchmark.h"
+#include "perft_suites.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/core/move_picker.h"
+#include "KitsuneEngine/core/attacks/attacks.h"
+
+static constexpr int32_t MATE_SCORE = 32000;
+
+struct PickerStats {
+	uint64_t m_Nodes = 0;
+	uint64_t m_Pickers = 0;
+	uint64_t m_NoisyGenerations = 0;
+	uint64_t m_QuietGenerations = 0;
+};
+
+static int32_t EvaluateMaterial( const Board &board ) {
+	int32_t score = 0;
+	for ( int piece = PAWN; piece < KING; piece++ ) {
+		score += SEE_VALUES[piece] * static_cast<int32_t>(board.GetPieceMask( static_cast<PieceType>(piece), WHITE ).
+			PopCount());
+		score -= SEE_VALUES[piece] * static_cast<int32_t>(board.GetPieceMask( static_cast<PieceType>(piece), BLACK ).
+			PopCount());
+	}
+
+	return board.GetSideToMove() == WHITE ? score : -score;
+}
+
+// Baseline for the staged picker: generates every move up front and orders it the way MovePicker does.
+class EagerPicker {
+	private:
+		Move m_Moves[MAX_MOVES];
+		int16_t m_Scores[MAX_MOVES];
+		uint8_t m_Count = 0;
+		uint8_t m_Index = 0;
+
+	public:
+		EagerPicker( const Board &board, const CastleMask &castleMask, Move ) {
+			m_Count = MoveGenerator( board, castleMask ).GenerateMoves<MoveGenMode::ALL>( m_Moves );
+			for ( uint8_t i = 0; i < m_Count; i++ ) {
+				const bool isNoisy = m_Moves[i].IsCapture() || m_Moves[i].IsPromotion();
+				m_Scores[i] = isNoisy
+					              ? static_cast<int16_t>(MovePicker::ScoreNoisy( board, m_Moves[i] ) + 10000)
+					              : MovePicker::ScoreQuiet( board, m_Moves[i] );
+			}
+		}
+
+		[[nodiscard]]
+		Move Next() {
+			if ( m_Index == m_Count ) {
+				return Move();
+			}
+
+			const auto best = std::max_element( m_Scores + m_Index, m_Scores + m_Count ) - m_Scores;
+			std::swap( m_Moves[m_Index], m_Moves[best] );
+			std::swap( m_Scores[m_Index], m_Scores[best] );
+			return m_Moves[m_Index++];
+		}
+
+		[[nodiscard]]
+		bool HasGeneratedNoisy() const {
+			return true;
+		}
+
+		[[nodiscard]]
+		bool HasGeneratedQuiets() const {
+			return true;
+		}
+};
+
+// Fixed-depth material alpha-beta, the smallest consumer that cuts off the way a real search does.
+template<typename Picker>
+static int32_t AlphaBeta( const Board &board, const CastleMask &castleMask, const uint8_t depth, int32_t alpha,
+                          const int32_t beta, PickerStats &stats ) {
+	stats.m_Nodes++;
+
+	if ( depth == 0 ) {
+		return EvaluateMaterial( board );
+	}
+
+	auto picker = Picker( board, castleMask, Move() );
+
+	int32_t bestScore = -MATE_SCORE;
+	bool hasMoves = false;
+
+	while ( const Move move = picker.Next() ) {
+		hasMoves = true;
+
+		Board child = board;
+		child.MakeMove( move, castleMask );
+
+		const int32_t score = -AlphaBeta<Picker>( child, castleMask, depth - 1, -beta, -alpha, stats );
+		bestScore = std::max( bestScore, score );
+		alpha = std::max( alpha, score );
+
+		if ( alpha >= beta ) {
+			break;
+		}
+	}
+
+	stats.m_Pickers++;
+	stats.m_NoisyGenerations += picker.HasGeneratedNoisy();
+	stats.m_QuietGenerations += picker.HasGeneratedQuiets();
+
+	if ( !hasMoves ) {
+		return Attacks::IsInCheck( board ) ? -MATE_SCORE : 0;
+	}
+
+	return bestScore;
+}
+
+template<typename Picker>
+static SuiteResult RunPickerSuite( const uint8_t depth, PickerStats &stats ) {
+	SuiteResult result{ };
+
+	for ( const auto &testCase : STANDARD_SUITE ) {
+		const auto board = Board( FEN( SplitString( testCase, ';' )[0] ) );
+		const auto castleMask = board.GenerateCastleMask();
+
+		const auto start = std::chrono::steady_clock::now();
+		static_cast<void>(AlphaBeta<Picker>( board, castleMask, depth, -MATE_SCORE, MATE_SCORE, stats ));
+		result.m_Microseconds += std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - start ).count();
+	}
+
+	result.m_Nodes = stats.m_Nodes;
+	return result;
+}
+
+void RunMovePickerBenchmark( const BenchmarkArgs &args ) {
+	const auto depth = static_cast<uint8_t>(GetIntArgument( args, 0, 4 ));
+
+	PickerStats eagerStats{ };
+	PickerStats stagedStats{ };
+	const SuiteResult eager = RunPickerSuite<EagerPicker>( depth, eagerStats );
+	const SuiteResult staged = RunPickerSuite<MovePicker>( depth, stagedStats );
+
+	std::cout << std::format( "{:<8} {:>12} {:>10} {:>14}\n", "Picker", "Nodes", "Time(ms)", "Nps" );
+	std::cout << std::format( "{:<8} {:>12} {:>10} {:>14}\n", "eager", eager.m_Nodes, eager.m_Microseconds / 1000,
+	                          eager.GetNps() );
+	std::cout << std::format( "{:<8} {:>12} {:>10} {:>14}\n\n", "staged", staged.m_Nodes, staged.m_Microseconds / 1000,
+	                          staged.GetNps() );
+
+	const uint64_t interiorNodes = stagedStats.m_Pickers;
+	std::cout << std::format( "Interior nodes:          {}\n", interiorNodes );
+	std::cout << std::format( "Noisy generations:       {} ({} avoided)\n", stagedStats.m_NoisyGenerations,
+	                          interiorNodes - stagedStats.m_NoisyGenerations );
+	std::cout << std::format( "Quiet generations:       {} ({} avoided, {:.1f}%)\n", stagedStats.m_QuietGenerations,
+	                          interiorNodes - stagedStats.m_QuietGenerations,
+	                          100.0 * ( interiorNodes - stagedStats.m_QuietGenerations ) / ( interiorNodes + 1 ) );
+}
@@ -0,0 +1,139 @@
+#include <format>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "benchmark.h"
+#include "perft_suites.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/eval/accumulator_stack.h"
+#include "KitsuneEngine/eval/nnue.h"
+#include "KitsuneEngine/search/search.h"
+#include "KitsuneEngine/search/transposition_table.h"
+
+static constexpr uint32_t NNUE_BENCH_PASSES = 200;
+static constexpr uint8_t NNUE_BENCH_SEARCH_DEPTH = 6;
+
+// Speed does not depend on the weights, so without a file a fixed random network is timed instead.
+static std::vector<int16_t> GenerateRandomNetwork() {
+	std::mt19937 random( 0x4E4E5545 );
+	std::uniform_int_distribution featureWeight( -32, 32 );
+	std::uniform_int_distribution outputWeight( -64, 64 );
+
+	std::vector<int16_t> network( NNUE_NETWORK_BYTES / sizeof( int16_t ) );
+	const size_t outputStart = ( NNUE_KING_BUCKETS * NNUE_INPUT_SIZE + 1 ) * NNUE_HIDDEN_SIZE;
+	for ( size_t i = 0; i < network.size(); i++ ) {
+		network[i] = static_cast<int16_t>(i < outputStart ? featureWeight( random ) : outputWeight( random ));
+	}
+
+	return network;
+}
+
+void RunNnueBenchmark( const BenchmarkArgs &args ) {
+	if ( !args.empty() ) {
+		if ( !Nnue::Load( args[0] ) ) {
+			std::cout << "Could not load network: " << args[0] << std::endl;
+			return;
+		}
+	} else {
+		const std::vector<int16_t> network = GenerateRandomNetwork();
+		Nnue::Load( network.data(), NNUE_NETWORK_BYTES );
+	}
+
+	std::vector<Board> boards;
+	for ( const auto &testCase : STANDARD_SUITE ) {
+		boards.emplace_back( FEN( SplitString( testCase, ';' )[0] ) );
+	}
+	for ( const auto &testCase : FRC_SUITE ) {
+		boards.emplace_back( FEN( SplitString( testCase, ';' )[0] ) );
+	}
+
+	std::cout << std::format( "Network: {}, hidden size {}\n\n", args.empty() ? "random" : args[0], NNUE_HIDDEN_SIZE );
+	std::cout << std::format( "{:<8} {:>14} {:>14} {:>14} {:>16}\n", "Kernel", "Refreshes/s", "Evals/s", "ns/eval",
+	                          "Checksum" );
+
+	const auto stack = std::make_unique<AccumulatorStack>();
+	const SimdLevel selected = Nnue::GetSimdLevel();
+	for ( const SimdLevel level : { SimdLevel::SCALAR, SimdLevel::AVX2, SimdLevel::AVX512 } ) {
+		if ( !Nnue::SetSimdLevel( level ) ) {
+			continue;
+		}
+
+		Accumulator accumulator;
+		SuiteResult refreshes{ };
+		auto start = std::chrono::steady_clock::now();
+		for ( uint32_t pass = 0; pass < NNUE_BENCH_PASSES; pass++ ) {
+			for ( const Board &board : boards ) {
+				Nnue::Refresh( board, accumulator );
+				refreshes.m_Nodes++;
+			}
+		}
+		refreshes.m_Microseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - start ).count();
+
+		// Every legal move is made, evaluated and unmade on the accumulator stack, the way the search uses it.
+		SuiteResult evals{ };
+		int64_t checksum = 0;
+		start = std::chrono::steady_clock::now();
+		for ( uint32_t pass = 0; pass < NNUE_BENCH_PASSES; pass++ ) {
+			for ( Board board : boards ) {
+				const CastleMask castleMask = board.GenerateCastleMask();
+				stack->Reset();
+
+				Move moves[MAX_MOVES];
+				const uint8_t count = MoveGenerator( board, castleMask ).GenerateMoves<MoveGenMode::ALL>( moves );
+				for ( uint8_t i = 0; i < count; i++ ) {
+					MoveUndo undo;
+					board.MakeMove( moves[i], castleMask, undo, &stack->Push() );
+					checksum += stack->Evaluate( board );
+					board.UnmakeMove( moves[i], undo );
+					stack->Pop();
+				}
+
+				evals.m_Nodes += count;
+			}
+		}
+		evals.m_Microseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - start ).count();
+
+		std::cout << std::format( "{:<8} {:>14} {:>14} {:>14.1f} {:>16}\n", Nnue::GetSimdLevelName(), refreshes.GetNps(),
+		                          evals.GetNps(), 1000.0 * evals.m_Microseconds / ( evals.m_Nodes + 1 ), checksum );
+	}
+
+	Nnue::SetSimdLevel( selected );
+
+	// Rows per node the search really applies with lazy updates, against updating both perspectives on every move. The
+	// eager count is a lower bound, it leaves out the refreshes king bucket changes would need.
+	std::cout << std::format( "\nSearch to depth {}\n{:<10} {:>12} {:>14} {:>14} {:>12}\n", NNUE_BENCH_SEARCH_DEPTH,
+	                          "Position", "Nodes", "Eager rows", "Lazy rows", "Refreshes" );
+
+	auto table = TranspositionTable( 16 );
+	const std::atomic<bool> stopSignal = false;
+	const auto search = std::make_unique<Search>( table, stopSignal );
+
+	AccumulatorStats total{ };
+	uint64_t totalNodes = 0;
+	for ( size_t i = 0; i < boards.size(); i += 4 ) {
+		table.Clear( 1 );
+		const SearchResult result = search->Run( boards[i], { .m_Depth = NNUE_BENCH_SEARCH_DEPTH } );
+		const AccumulatorStats &stats = search->GetAccumulatorStats();
+
+		std::cout << std::format( "{:<10} {:>12} {:>14} {:>14} {:>12}\n", i, result.m_Nodes, stats.m_RecordedRows,
+		                          stats.m_AppliedRows, stats.m_Refreshes );
+
+		total.m_RecordedRows += stats.m_RecordedRows;
+		total.m_AppliedRows += stats.m_AppliedRows;
+		total.m_Refreshes += stats.m_Refreshes;
+		totalNodes += result.m_Nodes;
+	}
+
+	std::cout << std::format( "\nRows per node: {:.2f} eager, {:.2f} lazy\n",
+	                          static_cast<double>(total.m_RecordedRows) / ( totalNodes + 1 ),
+	                          static_cast<double>(total.m_AppliedRows) / ( totalNodes + 1 ) );
+
+	if ( args.empty() ) {
+		Nnue::Unload();
+	}
+}
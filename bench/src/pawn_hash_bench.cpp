@@ -0,0 +1,95 @@
+#include <format>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "benchmark.h"
+#include "perft_suites.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/eval/evaluation.h"
+#include "KitsuneEngine/eval/nnue.h"
+#include "KitsuneEngine/eval/pawn_hash_table.h"
+#include "KitsuneEngine/search/search.h"
+#include "KitsuneEngine/search/transposition_table.h"
+
+static constexpr uint32_t PAWN_BENCH_PASSES = 50;
+
+// Evaluates every child of the suite positions with and without the table, then reports the hit rate the search sees,
+// which decides how much of the difference carries over.
+void RunPawnHashBenchmark( const BenchmarkArgs &args ) {
+	const auto depth = static_cast<uint8_t>(GetIntArgument( args, 0, 7 ));
+
+	std::vector<Board> boards;
+	std::vector<Board> children;
+	for ( const auto &testCase : STANDARD_SUITE ) {
+		Board &board = boards.emplace_back( FEN( SplitString( testCase, ';' )[0] ) );
+		const CastleMask castleMask = board.GenerateCastleMask();
+
+		Move moves[MAX_MOVES];
+		const uint8_t count = MoveGenerator( board, castleMask ).GenerateMoves<MoveGenMode::ALL>( moves );
+		for ( uint8_t i = 0; i < count; i++ ) {
+			Board &child = children.emplace_back( board );
+			child.MakeMove( moves[i], castleMask );
+		}
+	}
+
+	const auto table = std::make_unique<PawnHashTable>();
+	SuiteResult uncached{ };
+	SuiteResult cached{ };
+	int64_t checksum = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for ( uint32_t pass = 0; pass < PAWN_BENCH_PASSES; pass++ ) {
+		for ( const Board &board : children ) {
+			checksum += Evaluation::Evaluate( board );
+		}
+	}
+	uncached.m_Nodes = PAWN_BENCH_PASSES * children.size();
+	uncached.m_Microseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start ).count();
+
+	start = std::chrono::steady_clock::now();
+	for ( uint32_t pass = 0; pass < PAWN_BENCH_PASSES; pass++ ) {
+		for ( const Board &board : children ) {
+			checksum -= Evaluation::Evaluate( board, *table );
+		}
+	}
+	cached.m_Nodes = PAWN_BENCH_PASSES * children.size();
+	cached.m_Microseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start ).count();
+
+	std::cout << std::format( "{} positions, checksum {}\n{:<10} {:>14} {:>10}\n", children.size(), checksum, "Eval",
+	                          "Evals/s", "ns/eval" );
+	for ( const auto &[name, result] : { std::pair{ "uncached", uncached }, std::pair{ "cached", cached } } ) {
+		std::cout << std::format( "{:<10} {:>14} {:>10.1f}\n", name, result.GetNps(),
+		                          1000.0 * result.m_Microseconds / ( result.m_Nodes + 1 ) );
+	}
+
+	if ( Nnue::IsLoaded() ) {
+		return;
+	}
+
+	std::cout << std::format( "\nSearch to depth {}\n{:<10} {:>12} {:>12} {:>10}\n", depth, "Position", "Nodes", "Probes",
+	                          "Hit rate" );
+
+	auto transpositionTable = TranspositionTable( 16 );
+	const std::atomic<bool> stopSignal = false;
+	const auto search = std::make_unique<Search>( transpositionTable, stopSignal );
+
+	PawnHashStats total{ };
+	for ( size_t i = 0; i < boards.size(); i += 4 ) {
+		transpositionTable.Clear( 1 );
+		const SearchResult result = search->Run( boards[i], { .m_Depth = depth } );
+		const PawnHashStats &stats = search->GetPawnHashStats();
+
+		std::cout << std::format( "{:<10} {:>12} {:>12} {:>9.1f}%\n", i, result.m_Nodes, stats.m_Probes,
+		                          100.0 * stats.m_Hits / ( stats.m_Probes + 1 ) );
+
+		total.m_Probes += stats.m_Probes;
+		total.m_Hits += stats.m_Hits;
+	}
+
+	std::cout << std::format( "\nHit rate: {:.1f}% of {} probes\n", 100.0 * total.m_Hits / ( total.m_Probes + 1 ),
+	                          total.m_Probes );
+}
@@ -0,0 +1,99 @@
+#include <format>
+#include <iostream>
+
+#include "benchmark.h"
+#include "perft_suites.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/perft.h"
+
+std::vector<std::string> SplitString( const std::string &str, const char delimiter ) {
+	std::vector<std::string> tokens;
+	size_t start = 0;
+	size_t end = str.find( delimiter );
+
+	while ( end != std::string::npos ) {
+		tokens.push_back( str.substr( start, end - start ) );
+		start = end + 1;
+		end = str.find( delimiter, start );
+	}
+
+	tokens.push_back( str.substr( start ) );
+	return tokens;
+}
+
+uint32_t GetIntArgument( const BenchmarkArgs &args, const size_t index, const uint32_t defaultValue ) {
+	return args.size() > index ? static_cast<uint32_t>(std::stoul( args[index] )) : defaultValue;
+}
+
+SuiteResult RunPerftSuite( const std::string *suite, const size_t count, const uint8_t maxDepth, const PerftFunction perft ) {
+	SuiteResult result{ };
+
+	for ( size_t i = 0; i < count; i++ ) {
+		const auto testCase = SplitString( suite[i], ';' );
+		const auto board = Board( FEN( testCase[0] ) );
+		const auto castleMask = board.GenerateCastleMask();
+
+		uint8_t depth = 0;
+		uint64_t expected = 0;
+		for ( size_t j = 1; j < testCase.size(); j++ ) {
+			const auto target = SplitString( testCase[j], ' ' );
+			if ( const uint8_t targetDepth = target[0][1] - '0'; targetDepth <= maxDepth ) {
+				depth = targetDepth;
+				expected = std::stoull( target[1] );
+			}
+		}
+
+		if ( depth == 0 ) {
+			continue;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		const uint64_t nodes = perft( board, castleMask, depth, true );
+		result.m_Microseconds += std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - start ).count();
+
+		result.m_Nodes += nodes;
+		result.m_Mismatches += nodes != expected;
+	}
+
+	return result;
+}
+
+void RunPerftBenchmark( const BenchmarkArgs &args ) {
+	const auto depth = static_cast<uint8_t>(GetIntArgument( args, 0, 5 ));
+
+	struct Strategy {
+		std::string_view m_Name;
+		PerftFunction m_Function;
+	};
+
+	constexpr Strategy strategies[]{
+		{ "copy-make", PerftCopyMake },
+		{ "make/unmake", PerftMakeUnmake },
+	};
+
+	std::cout << std::format( "{:<10} {:<12} {:>14} {:>10} {:>14} {:>10}\n", "Suite", "Strategy", "Nodes", "Time(ms)", "Nps",
+	                          "Mismatches" );
+
+	const auto report = [&]( const std::string_view suiteName, const std::string *suite, const size_t count ) {
+		uint64_t bestNps = 0;
+		std::string_view bestName;
+
+		for ( const auto &strategy : strategies ) {
+			const SuiteResult result = RunPerftSuite( suite, count, depth, strategy.m_Function );
+			std::cout << std::format( "{:<10} {:<12} {:>14} {:>10} {:>14} {:>10}\n", suiteName, strategy.m_Name,
+			                          result.m_Nodes, result.m_Microseconds / 1000, result.GetNps(), result.m_Mismatches );
+
+			if ( result.GetNps() > bestNps ) {
+				bestNps = result.GetNps();
+				bestName = strategy.m_Name;
+			}
+		}
+
+		std::cout << std::format( "{:<10} fastest: {}\n\n", suiteName, bestName );
+	};
+
+	report( "standard", STANDARD_SUITE, std::size( STANDARD_SUITE ) );
+	report( "frc", FRC_SUITE, std::size( FRC_SUITE ) );
+	report( "enpassant", EN_PASSANT_SUITE, std::size( EN_PASSANT_SUITE ) );
+}
@@ -0,0 +1,36 @@
+#include <format>
+#include <iostream>
+
+#include "benchmark.h"
+#include "perft_suites.h"
+#include "KitsuneEngine/cpu_features.h"
+#include "KitsuneEngine/core/perft.h"
+#include "KitsuneEngine/core/attacks/attacks.h"
+
+void RunSliderBenchmark( const BenchmarkArgs &args ) {
+	const auto depth = static_cast<uint8_t>(GetIntArgument( args, 0, 5 ));
+	const SliderLookup selected = Attacks::GetSliderLookup();
+
+	std::cout << std::format( "CPU: {}, BMI2: {}, fast PEXT: {}\n", CpuFeatures::GetVendor(), CpuFeatures::HasBmi2(),
+	                          CpuFeatures::HasFastPext() );
+	std::cout << std::format( "Selected: {}\n\n", Attacks::GetSliderLookupName() );
+	std::cout << std::format( "{:<18} {:>14} {:>10} {:>14} {:>10}\n", "Lookup", "Nodes", "Time(ms)", "Nps", "Mismatches" );
+
+	for ( const SliderLookup lookup : { SliderLookup::MAGIC, SliderLookup::PEXT } ) {
+		if ( !Attacks::SetSliderLookup( lookup ) ) {
+			std::cout << "PEXT               unsupported on this CPU\n";
+			continue;
+		}
+
+		SuiteResult result = RunPerftSuite( STANDARD_SUITE, std::size( STANDARD_SUITE ), depth, PerftMakeUnmake );
+		const SuiteResult frc = RunPerftSuite( FRC_SUITE, std::size( FRC_SUITE ), depth, PerftMakeUnmake );
+		result.m_Nodes += frc.m_Nodes;
+		result.m_Microseconds += frc.m_Microseconds;
+		result.m_Mismatches += frc.m_Mismatches;
+
+		std::cout << std::format( "{:<18} {:>14} {:>10} {:>14} {:>10}\n", Attacks::GetSliderLookupName(), result.m_Nodes,
+		                          result.m_Microseconds / 1000, result.GetNps(), result.m_Mismatches );
+	}
+
+	Attacks::SetSliderLookup( selected );
+}
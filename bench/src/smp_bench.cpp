@@ -0,0 +1,58 @@
+#include <format>
+#include <iostream>
+#include <thread>
+
+#include "benchmark.h"
+#include "perft_suites.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/search/search_pool.h"
+#include "KitsuneEngine/search/transposition_table.h"
+
+static constexpr uint32_t SMP_HASH_MEGABYTES = 256;
+
+// Middlegame roots, so every thread count searches a comparable tree.
+static const std::string SMP_POSITIONS[]{
+	STANDARD_SUITE[0], STANDARD_SUITE[1], STANDARD_SUITE[16], FRC_SUITE[0],
+	FRC_SUITE[1], FRC_SUITE[2], FRC_SUITE[3], FRC_SUITE[4],
+};
+
+void RunSmpBenchmark( const BenchmarkArgs &args ) {
+	const uint32_t maxThreads = GetIntArgument( args, 0, 64 );
+	const uint32_t milliseconds = GetIntArgument( args, 1, 500 );
+
+	std::cout << std::format( "Hardware threads: {}, {} ms per position, {} MB hash\n\n",
+	                          std::thread::hardware_concurrency(), milliseconds, SMP_HASH_MEGABYTES );
+	std::cout << std::format( "{:>7} {:>14} {:>10} {:>14} {:>8} {:>9}\n", "Threads", "Nodes", "Time(ms)", "Nps",
+	                          "Scaling", "AvgDepth" );
+
+	auto table = TranspositionTable( SMP_HASH_MEGABYTES );
+	uint64_t singleThreadNps = 0;
+
+	for ( uint32_t threads = 1; threads <= maxThreads; threads *= 2 ) {
+		auto pool = SearchPool( table, threads );
+		SuiteResult total{ };
+		uint32_t depthSum = 0;
+
+		for ( const auto &testCase : SMP_POSITIONS ) {
+			const auto board = Board( FEN( SplitString( testCase, ';' )[0] ) );
+			table.Clear( threads );
+
+			const auto start = std::chrono::steady_clock::now();
+			const SearchResult result = pool.Run( board, { .m_Milliseconds = milliseconds } );
+			total.m_Microseconds += std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now() - start ).count();
+
+			total.m_Nodes += result.m_Nodes;
+			depthSum += result.m_Depth;
+		}
+
+		if ( threads == 1 ) {
+			singleThreadNps = total.GetNps();
+		}
+
+		std::cout << std::format( "{:>7} {:>14} {:>10} {:>14} {:>7.2f}x {:>9.1f}\n", threads, total.m_Nodes,
+		                          total.m_Microseconds / 1000, total.GetNps(),
+		                          static_cast<double>(total.GetNps()) / ( singleThreadNps + 1 ),
+		                          static_cast<double>(depthSum) / std::size( SMP_POSITIONS ) );
+	}
+}
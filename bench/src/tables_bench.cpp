@@ -0,0 +1,35 @@
+#include <format>
+#include <iostream>
+
+#include "benchmark.h"
+#include "KitsuneEngine/core/attacks/attacks.h"
+
+void RunTablesBenchmark( const BenchmarkArgs &args ) {
+	const uint32_t iterations = GetIntArgument( args, 0, 100 );
+	const SliderLookup selected = Attacks::GetSliderLookup();
+
+	std::cout << std::format( "Slider tables: {} KB rook + {} KB bishop\n", ROOK_TABLE_SIZE * sizeof( Bitboard ) / 1024,
+	                          BISHOP_TABLE_SIZE * sizeof( Bitboard ) / 1024 );
+	std::cout << std::format( "{:<18} {:>12}\n", "Layout", "Init(us)" );
+
+	for ( const SliderLookup lookup : { SliderLookup::MAGIC, SliderLookup::PEXT } ) {
+		const auto start = std::chrono::steady_clock::now();
+		bool supported = true;
+
+		for ( uint32_t i = 0; i < iterations && supported; i++ ) {
+			supported = Attacks::SetSliderLookup( lookup );
+		}
+
+		const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - start ).count();
+
+		if ( !supported ) {
+			std::cout << "PEXT               unsupported on this CPU\n";
+			continue;
+		}
+
+		std::cout << std::format( "{:<18} {:>12}\n", Attacks::GetSliderLookupName(), elapsed / iterations );
+	}
+
+	Attacks::SetSliderLookup( selected );
+}
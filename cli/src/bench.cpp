@@ -0,0 +1,75 @@
+#include "bench.h"
+
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <string>
+
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/search/search_pool.h"
+#include "KitsuneEngine/search/transposition_table.h"
+
+// Independent of the Hash option, so the signature does not depend on engine settings.
+static constexpr uint32_t BENCH_HASH_MEGABYTES = 16;
+
+// Taken from the perft positions in tests/standard.cpp: openings, castling, minor piece, rook and queen endings, pawn
+// races and promotions.
+static const std::string BENCH_POSITIONS[]{
+	"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+	"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+	"r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1",
+	"r3k2r/8/8/8/8/8/8/R3K2R b KQkq - 0 1",
+	"8/1n4N1/2k5/8/8/5K2/1N4n1/8 w - - 0 1",
+	"B6b/8/8/8/2K5/4k3/8/b6B w - - 0 1",
+	"7k/RR6/8/8/8/8/rr6/7K w - - 0 1",
+	"R6r/8/8/2K5/5k2/8/8/r6R w - - 0 1",
+	"K7/8/8/3Q4/4q3/8/8/7k w - - 0 1",
+	"8/2k1p3/3pP3/3P2K1/8/8/8/8 w - - 0 1",
+	"8/8/3k4/3p4/3P4/3K4/8/8 w - - 0 1",
+	"3k4/3pp3/8/8/8/8/3PP3/3K4 b - - 0 1",
+	"n1n5/1Pk5/8/8/8/8/5Kp1/5N1N w - - 0 1",
+	"8/PPPk4/8/8/8/8/4Kppp/8 w - - 0 1",
+	"n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+	"8/Pk6/8/8/8/8/6Kp/8 b - - 0 1",
+};
+
+void RunBench( const uint8_t depth, const bool machineReadable ) {
+	auto table = TranspositionTable( BENCH_HASH_MEGABYTES );
+	auto pool = SearchPool( table, 1 );
+
+	// Tablebases and the network depend on the files installed, so the node count is taken with the PSQT evaluation
+	// and without probing.
+	const SearchLimits limits{ .m_Depth = depth, .m_UseTablebases = false, .m_UseNetwork = false };
+
+	uint64_t nodes = 0;
+	uint64_t microseconds = 0;
+
+	for ( size_t i = 0; i < std::size( BENCH_POSITIONS ); i++ ) {
+		table.Clear();
+
+		const auto start = std::chrono::steady_clock::now();
+		const SearchResult result = pool.Run( Board( FEN( BENCH_POSITIONS[i] ) ), limits );
+		microseconds += std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - start ).count();
+
+		nodes += result.m_Nodes;
+
+		if ( !machineReadable ) {
+			std::cout << std::format( "{:>2}/{} {:>10} nodes  {:<6} {}\n", i + 1, std::size( BENCH_POSITIONS ),
+			                          result.m_Nodes, result.m_BestMove.ToString( false ), BENCH_POSITIONS[i] );
+		}
+	}
+
+	const uint64_t milliseconds = microseconds / 1000;
+	const uint64_t nps = nodes * 1000000 / ( microseconds + 1 );
+
+	if ( machineReadable ) {
+		std::cout << std::format( R"({{"depth":{},"positions":{},"nodes":{},"time_ms":{},"nps":{}}})",
+		                          depth, std::size( BENCH_POSITIONS ), nodes, milliseconds, nps ) << std::endl;
+		return;
+	}
+
+	std::cout << std::format( "\nNodes: {}\nTime: {}ms\nNPS: {}\n{} nodes {} nps", nodes, milliseconds, nps, nodes, nps )
+		<< std::endl;
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+constexpr uint8_t DEFAULT_BENCH_DEPTH = 8;
+
+// Searches a fixed set of positions on one thread with a freshly cleared table of fixed size each time, so the node
+// count is a signature that only changes when search behaviour does. Neither the network nor the tablebases are used,
+// whatever is loaded. The machine-readable form is a single JSON line.
+void RunBench( uint8_t depth, bool machineReadable );
@@ -1,55 +1,39 @@
-#include <chrono>
-#include <fstream>
 #include <iostream>
-#include <thread>
+#include <string>
 
 #include "logo.h"
-#include "KitsuneEngine/core/bitboard.h"
-#include "KitsuneEngine/core/board.h"
-#include "KitsuneEngine/core/fen.h"
-#include "KitsuneEngine/core/perft.h"
+#include "uci.h"
+#include "KitsuneEngine/core/attacks/attacks.h"
+
+int main( const int argc, char **argv ) {
+	// Commands given on the command line, such as "bench 8 json" for CI, are run once without the banner.
+	if ( argc > 1 ) {
+		std::string command;
+		for ( int i = 1; i < argc; i++ ) {
+			command += ( i > 1 ? " " : "" ) + std::string( argv[i] );
+		}
+
+		Uci uci;
+		uci.HandleCommand( command );
+		return 0;
+	}
 
-int main() {
 	const auto infos = new std::string[27]{ };
 	infos[3] = "Kitsune Chess Engine";
 	infos[5] = "by Tomasz Jaworski";
 	infos[6] = "and Dorian Kernel";
 	infos[8] = "Version: 0.1";
+	infos[9] = "Sliders: " + Attacks::GetSliderLookupName();
 	infos[11] = "Supported Non-UCI Commands:";
 	infos[12] = "   perft <depth>";
 	infos[13] = "   bulk <depth>";
-	infos[14] = "   bench <depth>";
+	infos[14] = "   bench <depth> [json]";
 	infos[15] = "   eval";
 	infos[16] = "   draw";
 	std::cout << "\n" << GetASCIILogo( infos ) << std::endl << std::endl;
 
-	const auto fen = FEN();
-	std::cout << fen.ToString() << std::endl;
-
-	auto board = Board( fen );
-	const auto castleMask = board.GenerateCastleMask();
-
-	std::cout << board.ToString() << std::endl;
-
-	auto thread = std::jthread( [&board, &castleMask]( std::stop_token token ) {
-		auto t = std::chrono::high_resolution_clock::now();
-		uint64_t result = Perft( board, castleMask, 6, false, true, true );
-		auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-			std::chrono::high_resolution_clock::now() - t );
-		std::cout << "Result: " << result << std::endl;
-		std::cout << "Time: " << duration << std::endl;
-		std::cout << "Speed: " << ( result * 1000 / ( duration.count() + 1 ) ) << "nps" << std::endl << std::endl << std::endl;
-
-		t = std::chrono::high_resolution_clock::now();
-		result = Perft( board, castleMask, 7, true, true, true );
-		duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-			std::chrono::high_resolution_clock::now() - t );
-		std::cout << "Result: " << result << std::endl;
-		std::cout << "Time: " << duration << std::endl;
-		std::cout << "Speed: " << ( result * 1000 / ( duration.count() + 1 ) ) << "nps" << std::endl << std::endl << std::endl;
-	} );
-
-	thread.join();
+	Uci uci;
+	uci.Loop();
 
 	return 0;
 }
@@ -0,0 +1,344 @@
+#include "uci.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+
+#include "bench.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/core/perft.h"
+#include "KitsuneEngine/eval/evaluation.h"
+#include "KitsuneEngine/eval/nnue.h"
+#include "KitsuneEngine/tablebase/syzygy.h"
+
+static constexpr uint32_t DEFAULT_HASH_MEGABYTES = 64;
+static constexpr uint32_t MAX_HASH_MEGABYTES = 65536;
+static constexpr uint32_t MAX_THREADS = 1024;
+
+// Loaded at startup when present in the working directory, otherwise the search falls back to the PSQT evaluation.
+static const std::string DEFAULT_EVAL_FILE = "kitsune.nnue";
+
+// Kept back from the clock for GUI and pipe latency.
+static constexpr int64_t MOVE_OVERHEAD_MILLISECONDS = 20;
+static constexpr int64_t DEFAULT_MOVES_TO_GO = 30;
+
+static std::mutex s_OutputMutex;
+
+// Info lines come from the search thread and replies from the input thread, so whole lines are written under a lock.
+static void Send( const std::string &message ) {
+	std::lock_guard lock( s_OutputMutex );
+	std::cout << message << std::endl;
+}
+
+static UciTokens Tokenize( const std::string &line ) {
+	UciTokens tokens;
+	std::istringstream stream( line );
+	for ( std::string token; stream >> token; ) {
+		tokens.push_back( token );
+	}
+
+	return tokens;
+}
+
+static int64_t ParseNumber( const UciTokens &tokens, const size_t index, const int64_t defaultValue ) {
+	if ( index >= tokens.size() ) {
+		return defaultValue;
+	}
+
+	int64_t value = defaultValue;
+	const std::string &token = tokens[index];
+	std::from_chars( token.data(), token.data() + token.size(), value );
+	return value;
+}
+
+static uint64_t AllocateTime( const int64_t time, const int64_t increment, const int64_t movesToGo ) {
+	const int64_t available = std::max<int64_t>( time - MOVE_OVERHEAD_MILLISECONDS, 1 );
+	const int64_t budget = available / ( movesToGo > 0 ? movesToGo : DEFAULT_MOVES_TO_GO ) + increment * 3 / 4;
+	return static_cast<uint64_t>(std::clamp<int64_t>( budget, 1, std::max<int64_t>( available / 2, 1 ) ));
+}
+
+Uci::Uci()
+	: m_Table( DEFAULT_HASH_MEGABYTES ), m_Pool( m_Table, 1 ), m_CastleMask( m_Board.GenerateCastleMask() ),
+	  m_BookRandom( std::random_device()() ) {
+	Nnue::Load( DEFAULT_EVAL_FILE );
+}
+
+Uci::~Uci() {
+	StopSearch();
+}
+
+void Uci::Loop() {
+	for ( std::string line; std::getline( std::cin, line ); ) {
+		if ( !HandleCommand( line ) ) {
+			break;
+		}
+	}
+
+	StopSearch();
+}
+
+bool Uci::HandleCommand( const std::string &line ) {
+	const UciTokens tokens = Tokenize( line );
+	if ( tokens.empty() ) {
+		return true;
+	}
+
+	const std::string &command = tokens[0];
+
+	if ( command == "uci" ) {
+		HandleUci();
+	} else if ( command == "isready" ) {
+		Send( "readyok" );
+	} else if ( command == "ucinewgame" ) {
+		StopSearch();
+		m_Table.Clear( m_Pool.GetThreadCount() );
+	} else if ( command == "setoption" ) {
+		HandleSetOption( tokens );
+	} else if ( command == "position" ) {
+		HandlePosition( tokens );
+	} else if ( command == "go" ) {
+		HandleGo( tokens );
+	} else if ( command == "stop" ) {
+		StopSearch();
+	} else if ( command == "quit" ) {
+		return false;
+	} else if ( command == "bench" ) {
+		StopSearch();
+		RunBench( static_cast<uint8_t>(std::clamp<int64_t>( ParseNumber( tokens, 1, DEFAULT_BENCH_DEPTH ), 1,
+		                                                     MAX_SEARCH_DEPTH )),
+		          std::ranges::find( tokens, "json" ) != tokens.end() );
+	} else if ( command == "perft" || command == "bulk" ) {
+		HandlePerft( tokens, command == "bulk" );
+	} else if ( command == "eval" ) {
+		Send( Nnue::IsLoaded()
+			      ? std::format( "Evaluation: {} (NNUE, {})", Nnue::Evaluate( m_Board ), Nnue::GetSimdLevelName() )
+			      : std::format( "Evaluation: {} (PSQT)", Evaluation::Evaluate( m_Board ) ) );
+	} else if ( command == "draw" ) {
+		Send( m_Board.ToString() );
+	} else {
+		Send( std::format( "info string Unknown command: {}", command ) );
+	}
+
+	return true;
+}
+
+void Uci::HandleUci() const {
+	Send( "id name Kitsune 0.1" );
+	Send( "id author Tomasz Jaworski and Dorian Kernel" );
+	Send( std::format( "option name Hash type spin default {} min 1 max {}", DEFAULT_HASH_MEGABYTES,
+	                   MAX_HASH_MEGABYTES ) );
+	Send( std::format( "option name Threads type spin default 1 min 1 max {}", MAX_THREADS ) );
+	Send( "option name UCI_Chess960 type check default false" );
+	Send( std::format( "option name EvalFile type string default {}", DEFAULT_EVAL_FILE ) );
+	Send( "option name BookFile type string default <empty>" );
+	Send( "option name SyzygyPath type string default <empty>" );
+	Send( "uciok" );
+}
+
+void Uci::HandleSetOption( const UciTokens &tokens ) {
+	const auto nameIt = std::ranges::find( tokens, "name" );
+	const auto valueIt = std::ranges::find( tokens, "value" );
+	if ( nameIt == tokens.end() || valueIt == tokens.end() || valueIt + 1 == tokens.end() ) {
+		return;
+	}
+
+	std::string name;
+	for ( auto it = nameIt + 1; it != valueIt; ++it ) {
+		name += ( name.empty() ? "" : " " ) + *it;
+	}
+
+	std::string value;
+	for ( auto it = valueIt + 1; it != tokens.end(); ++it ) {
+		value += ( value.empty() ? "" : " " ) + *it;
+	}
+
+	const size_t valueIndex = valueIt + 1 - tokens.begin();
+	StopSearch();
+
+	if ( name == "Hash" ) {
+		const auto megabytes = static_cast<uint32_t>(std::clamp<int64_t>(
+			ParseNumber( tokens, valueIndex, DEFAULT_HASH_MEGABYTES ), 1, MAX_HASH_MEGABYTES ));
+		if ( !m_Table.Resize( megabytes ) ) {
+			Send( std::format( "info string Could not allocate {} MB of hash, using {} MB", megabytes,
+			                   m_Table.GetSizeInBytes() / ( 1024 * 1024 ) ) );
+		}
+	} else if ( name == "Threads" ) {
+		m_Pool.SetThreadCount( static_cast<uint32_t>(std::clamp<int64_t>( ParseNumber( tokens, valueIndex, 1 ), 1,
+		                                                                   MAX_THREADS )) );
+	} else if ( name == "UCI_Chess960" ) {
+		m_Chess960 = tokens[valueIndex] == "true";
+	} else if ( name == "EvalFile" ) {
+		if ( value == "<empty>" ) {
+			Nnue::Unload();
+		} else {
+			Send( Nnue::Load( value )
+				      ? std::format( "info string Loaded network {}", value )
+				      : std::format( "info string Could not load network {}", value ) );
+		}
+	} else if ( name == "BookFile" ) {
+		if ( value == "<empty>" ) {
+			m_Book.Close();
+		} else {
+			Send( m_Book.Open( value )
+				      ? std::format( "info string Loaded book {} with {} entries", value, m_Book.GetEntryCount() )
+				      : std::format( "info string Could not load book {}", value ) );
+		}
+	} else if ( name == "SyzygyPath" ) {
+		if ( value == "<empty>" ) {
+			Syzygy::Free();
+		} else {
+			Send( std::format( "info string Found {} tablebases, up to {} pieces", Syzygy::Init( value ),
+			                   Syzygy::GetMaxPieces() ) );
+		}
+	} else {
+		Send( std::format( "info string Unknown option: {}", name ) );
+	}
+}
+
+void Uci::HandlePosition( const UciTokens &tokens ) {
+	const auto movesIt = std::ranges::find( tokens, "moves" );
+
+	std::string fen;
+	if ( tokens.size() > 1 && tokens[1] == "startpos" ) {
+		fen = FEN().ToString();
+	} else if ( tokens.size() > 1 && tokens[1] == "fen" ) {
+		for ( auto it = tokens.begin() + 2; it != movesIt; ++it ) {
+			fen += ( fen.empty() ? "" : " " ) + *it;
+		}
+	}
+
+	if ( !FEN::IsFenValid( fen ) ) {
+		Send( std::format( "info string Invalid position: {}", fen ) );
+		return;
+	}
+
+	m_Board = Board( FEN( fen ) );
+	m_CastleMask = m_Board.GenerateCastleMask();
+	m_History.clear();
+
+	if ( movesIt == tokens.end() ) {
+		return;
+	}
+
+	for ( auto it = movesIt + 1; it != tokens.end(); ++it ) {
+		const Move move = ParseMove( *it );
+		if ( !move ) {
+			Send( std::format( "info string Illegal move: {}", *it ) );
+			return;
+		}
+
+		m_History.push_back( m_Board.GetHash() );
+		m_Board.MakeMove( move, m_CastleMask );
+		if ( m_Board.GetHalfMoves() == 0 ) {
+			m_History.clear();
+		}
+	}
+}
+
+void Uci::HandleGo( const UciTokens &tokens ) {
+	StopSearch();
+
+	SearchLimits limits{ };
+	int64_t time[2]{ -1, -1 };
+	int64_t increment[2]{ };
+	int64_t movesToGo = 0;
+	bool analysis = false;
+
+	for ( size_t i = 1; i < tokens.size(); i++ ) {
+		const std::string &token = tokens[i];
+		if ( token == "infinite" ) {
+			analysis = true;
+		} else if ( token == "depth" ) {
+			analysis = true;
+			limits.m_Depth = static_cast<uint8_t>(std::clamp<int64_t>( ParseNumber( tokens, ++i, MAX_SEARCH_DEPTH ), 1,
+			                                                            MAX_SEARCH_DEPTH ));
+		} else if ( token == "nodes" ) {
+			analysis = true;
+			limits.m_Nodes = static_cast<uint64_t>(std::max<int64_t>( ParseNumber( tokens, ++i, 0 ), 0 ));
+		} else if ( token == "movetime" ) {
+			limits.m_Milliseconds = static_cast<uint64_t>(std::max<int64_t>( ParseNumber( tokens, ++i, 0 ), 1 ));
+		} else if ( token == "wtime" || token == "btime" ) {
+			time[token == "btime"] = std::max<int64_t>( ParseNumber( tokens, ++i, 0 ), 0 );
+		} else if ( token == "winc" || token == "binc" ) {
+			increment[token == "binc"] = std::max<int64_t>( ParseNumber( tokens, ++i, 0 ), 0 );
+		} else if ( token == "movestogo" ) {
+			movesToGo = ParseNumber( tokens, ++i, 0 );
+		}
+	}
+
+	const bool chess960 = IsChess960();
+
+	// Fixed depth or node searches are analysis too, the book would only get in their way.
+	if ( !analysis && m_Book.IsOpen() ) {
+		if ( const Move bookMove = m_Book.Probe( m_Board, m_BookRandom() ) ) {
+			Send( std::format( "bestmove {}", bookMove.ToString( chess960 ) ) );
+			return;
+		}
+	}
+
+	const SideToMove side = m_Board.GetSideToMove();
+	if ( time[side] >= 0 && limits.m_Milliseconds == 0 ) {
+		limits.m_Milliseconds = AllocateTime( time[side], increment[side], movesToGo );
+	}
+
+	Syzygy::ResetStats();
+	m_Pool.Start( m_Board, limits, [this, chess960]( const SearchInfo &info ) {
+		std::string pv;
+		for ( uint8_t i = 0; i < info.m_PvLength; i++ ) {
+			pv += " " + info.m_Pv[i].ToString( chess960 );
+		}
+
+		const SyzygyStats tbStats = Syzygy::GetStats();
+		Send( std::format( "info depth {} seldepth {} score {} nodes {} nps {} hashfull {} tbhits {} time {} pv{}",
+		                   info.m_Depth, info.m_SelDepth, Search::ScoreToString( info.m_Score ), info.m_Nodes,
+		                   info.m_Nodes * 1000 / std::max<uint64_t>( info.m_Milliseconds, 1 ), m_Table.GetHashfull(),
+		                   tbStats.m_WdlHits + tbStats.m_DtzHits, info.m_Milliseconds, pv ) );
+	}, m_History );
+
+	m_SearchWaiter = std::jthread( [this, chess960] {
+		const SearchResult result = m_Pool.Wait();
+		Send( std::format( "bestmove {}", result.m_BestMove ? result.m_BestMove.ToString( chess960 ) : "0000" ) );
+	} );
+}
+
+void Uci::HandlePerft( const UciTokens &tokens, const bool bulk ) const {
+	const auto depth = static_cast<uint8_t>(std::clamp<int64_t>( ParseNumber( tokens, 1, 5 ), 1, MAX_PLY - 1 ));
+	const uint32_t threadCount = std::max( std::thread::hardware_concurrency(), 1u );
+
+	const auto start = std::chrono::steady_clock::now();
+	const uint64_t result = ParallelPerft( m_Board, m_CastleMask, depth, bulk, true, threadCount );
+	const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - start ).count();
+
+	Send( std::format( "\nResult: {}\nTime: {}ms\nSpeed: {}nps\n", result, duration, result * 1000 / ( duration + 1 ) ) );
+}
+
+void Uci::StopSearch() {
+	m_Pool.Stop();
+	WaitForSearch();
+}
+
+void Uci::WaitForSearch() {
+	if ( m_SearchWaiter.joinable() ) {
+		m_SearchWaiter.join();
+	}
+}
+
+Move Uci::ParseMove( const std::string &text ) const {
+	Move moves[MAX_MOVES]{ };
+	const uint8_t count = MoveGenerator( m_Board, m_CastleMask ).GenerateMoves<MoveGenMode::ALL>( moves );
+
+	const bool chess960 = IsChess960();
+	for ( uint8_t i = 0; i < count; i++ ) {
+		if ( moves[i].ToString( chess960 ) == text ) {
+			return moves[i];
+		}
+	}
+
+	return Move();
+}
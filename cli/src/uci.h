@@ -0,0 +1,69 @@
+#pragma once
+
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "KitsuneEngine/book/polyglot_book.h"
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/core/castle_mask.h"
+#include "KitsuneEngine/search/search_pool.h"
+#include "KitsuneEngine/search/transposition_table.h"
+
+using UciTokens = std::vector<std::string>;
+
+// UCI front-end. Commands are read on the calling thread while the search runs on the pool's threads, so stop and
+// isready are answered straight away, and a separate waiter thread prints bestmove once the search ends.
+class Uci {
+	private:
+		TranspositionTable m_Table;
+		SearchPool m_Pool;
+
+		Board m_Board;
+		CastleMask m_CastleMask;
+		bool m_Chess960 = false;
+
+		// Hashes of the positions before m_Board since the last capture or pawn move.
+		std::vector<uint64_t> m_History;
+
+		PolyglotBook m_Book;
+		std::mt19937_64 m_BookRandom;
+
+		std::jthread m_SearchWaiter;
+
+	public:
+		Uci();
+
+		~Uci();
+
+		// Returns once quit is received or the input ends.
+		void Loop();
+
+		// Returns false for quit.
+		bool HandleCommand( const std::string &line );
+
+	private:
+		void HandleUci() const;
+
+		void HandleSetOption( const UciTokens &tokens );
+
+		void HandlePosition( const UciTokens &tokens );
+
+		void HandleGo( const UciTokens &tokens );
+
+		void HandlePerft( const UciTokens &tokens, bool bulk ) const;
+
+		void StopSearch();
+
+		void WaitForSearch();
+
+		[[nodiscard]]
+		bool IsChess960() const {
+			return m_Chess960 || m_Board.GetChess960();
+		}
+
+		// Matches the move against the legal moves, so anything the GUI sends that is not legal is rejected.
+		[[nodiscard]]
+		Move ParseMove( const std::string &text ) const;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "KitsuneEngine/mapped_file.h"
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/core/move.h"
+
+// Size of one entry on disk.
+constexpr uint32_t POLYGLOT_ENTRY_BYTES = 16;
+
+struct PolyglotEntry {
+	uint64_t m_Key;
+	uint16_t m_Move;
+	uint16_t m_Weight;
+	uint32_t m_Learn;
+};
+
+// A Polyglot opening book: big-endian entries sorted by key. The file is memory-mapped and binary searched in place, so
+// opening it reads nothing and a lookup only touches the pages along the search path.
+class PolyglotBook {
+	private:
+		MappedFile m_File;
+		uint64_t m_EntryCount = 0;
+
+	public:
+		// Fails on a missing file or one that is empty or not a whole number of entries. Closes any previous book first.
+		bool Open( const std::string &path );
+
+		void Close();
+
+		[[nodiscard]]
+		bool IsOpen() const {
+			return m_File.IsOpen();
+		}
+
+		[[nodiscard]]
+		uint64_t GetEntryCount() const {
+			return m_EntryCount;
+		}
+
+		[[nodiscard]]
+		PolyglotEntry GetEntry( uint64_t index ) const;
+
+		// The index range [first, last) of the entries stored under the key.
+		[[nodiscard]]
+		std::pair<uint64_t, uint64_t> FindEntries( uint64_t key ) const;
+
+		// Picks one of the position's book moves with probability proportional to its weight, using random as the draw.
+		// Entries that are not legal here, such as those of a key collision, are ignored. Returns the null move when the
+		// position is out of book.
+		[[nodiscard]]
+		Move Probe( const Board &board, uint64_t random ) const;
+
+		[[nodiscard]]
+		Move Probe( const Board &board, uint64_t key, uint64_t random ) const;
+
+	private:
+		// Book moves keep promotions in bits 12 to 14 and write castling as the king taking its own rook, which is what
+		// our moves print in chess960 notation.
+		[[nodiscard]]
+		static std::string GetMoveString( uint16_t bookMove );
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+#include "KitsuneEngine/core/board.h"
+
+// 768 piece-square keys, then 4 castling rights, 8 en passant files and the side to move.
+constexpr uint32_t POLYGLOT_RANDOM_COUNT = 781;
+
+// The key the format description gives for the starting position.
+constexpr uint64_t POLYGLOT_START_KEY = 0x463B96181691FC9C;
+
+// Polyglot books are indexed by their own Zobrist keys, built from a fixed Random64 table laid out differently from
+// our SEEDS, so they are computed from scratch rather than updated by the board. Lookups are rare enough for that.
+class PolyglotKey {
+	public:
+		[[nodiscard]]
+		static uint64_t Compute( const Board &board );
+};
@@ -1,14 +1,11 @@
 #pragma once
 
-#if PEXT
+#if defined(_MSC_VER)
 #include <immintrin.h>
-#include "../../engine/src/core/attacks/attack_arrays/bishop_attacks_pext.h"
-#include "../../engine/src/core/attacks/attack_arrays/rook_attacks_pext.h"
-#else
-#include "../../engine/src/core/attacks/attack_arrays/bishop_attacks.h"
-#include "../../engine/src/core/attacks/attack_arrays/rook_attacks.h"
 #endif
 
+#include <string>
+
 #include "KitsuneEngine/types.h"
 #include "KitsuneEngine/core/bitboard.h"
 #include "KitsuneEngine/core/square.h"
@@ -21,34 +18,60 @@
 
 class Board;
 
+enum class SliderLookup : uint8_t {
+	MAGIC = 0,
+	PEXT = 1,
+};
+
 class Attacks {
+	private:
+		// Picked once at startup from the CPU features. The branch on it is perfectly predicted, so a single binary
+		// serves both BMI2 and non-BMI2 machines.
+		static SliderLookup s_SliderLookup;
+
+		// Built for the selected lookup by SetSliderLookup, which first runs during static initialisation.
+		static Bitboard s_RookAttacks[ROOK_TABLE_SIZE];
+		static Bitboard s_BishopAttacks[BISHOP_TABLE_SIZE];
+
 	public:
 		[[nodiscard]]
-		static constexpr Bitboard GetBishopAttacks( const Square square, const Bitboard occupancy ) {
+		static Bitboard GetBishopAttacks( const Square square, const Bitboard occupancy ) {
 			const auto mask = BISHOP_MASKS[square];
-#if !PEXT
+			if ( s_SliderLookup == SliderLookup::PEXT ) {
+				return s_BishopAttacks[BISHOP_OFFSETS[square] + ParallelExtract( occupancy, mask )];
+			}
+
 			const auto magic = BISHOP_MAGICS[square];
 			const auto shift = 64 - BISHOP_OCCUPANCY_COUNT[square];
 			const uint64_t index = ( ( occupancy & mask ) * magic ) >> shift;
-#else
-			const uint64_t index = _pext_u64(occupancy, mask);
-#endif
-			return BISHOP_ATTACKS[square * 512 + index];
+			return s_BishopAttacks[BISHOP_OFFSETS[square] + index];
 		}
 
 		[[nodiscard]]
-		static constexpr Bitboard GetRookAttacks( const Square square, const Bitboard occupancy ) {
+		static Bitboard GetRookAttacks( const Square square, const Bitboard occupancy ) {
 			const auto mask = ROOK_MASKS[square];
-#if !PEXT
+			if ( s_SliderLookup == SliderLookup::PEXT ) {
+				return s_RookAttacks[ROOK_OFFSETS[square] + ParallelExtract( occupancy, mask )];
+			}
+
 			const auto magic = ROOK_MAGICS[square];
 			const auto shift = 64 - ROOK_OCCUPANCY_COUNT[square];
 			const uint64_t index = ( ( occupancy & mask ) * magic ) >> shift;
-#else
-			const uint64_t index = _pext_u64(occupancy, mask);
-#endif
-			return ROOK_ATTACKS[square * 4096 + index];
+			return s_RookAttacks[ROOK_OFFSETS[square] + index];
 		}
 
+		[[nodiscard]]
+		static SliderLookup GetSliderLookup() {
+			return s_SliderLookup;
+		}
+
+		// Rebuilds the slider tables in the layout of the given lookup. Returns false (and keeps the current path) when
+		// PEXT is requested on a CPU without BMI2.
+		static bool SetSliderLookup( SliderLookup lookup );
+
+		[[nodiscard]]
+		static std::string GetSliderLookupName();
+
 		[[nodiscard]]
 		static constexpr Bitboard GetPawnAttacks( const Square square, const SideToMove side ) {
 			return PAWN_MOVES[side * 64 + square];
@@ -81,6 +104,24 @@ class Attacks {
 		static Bitboard AllAttackersToSquare( const Board &board, Square square, SideToMove defenderSide,
 		                                      Bitboard occupancy );
 
+		// Attackers of both colors. Pieces missing from the occupancy still show up if they attack the square, callers
+		// mask them out.
+		[[nodiscard]]
+		static Bitboard AllAttackersToSquare( const Board &board, Square square, Bitboard occupancy );
+
 		[[nodiscard]]
 		static Bitboard GenerateAttackMap( const Board &board, SideToMove defenderSide );
+
+	private:
+		// Only reached after BMI2 was detected, so the instruction is emitted without enabling BMI2 for the whole build.
+		[[nodiscard]]
+		static uint64_t ParallelExtract( const uint64_t value, const uint64_t mask ) {
+#if defined(_MSC_VER)
+			return _pext_u64( value, mask );
+#else
+			uint64_t result;
+			asm( "pextq %2, %1, %0" : "=r"( result ) : "r"( value ), "r"( mask ) );
+			return result;
+#endif
+		}
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cassert>
 #include <iostream>
 
 #include "bitboard.h"
@@ -7,20 +8,47 @@
 #include "move.h"
 #include "zobrist_hash.h"
 #include "../types.h"
+#include "../eval/psqt.h"
 
 struct FEN;
 
+struct DirtyPiece {
+	PieceType m_Piece;
+	SideToMove m_Color;
+	Square m_Square;
+};
+
+// The pieces a move added and removed, for evaluation state that is brought up to date lazily. A castle is the
+// largest change, with two of each.
+struct DirtyPieces {
+	DirtyPiece m_Added[2];
+	DirtyPiece m_Removed[2];
+	uint8_t m_AddedCount;
+	uint8_t m_RemovedCount;
+};
+
+struct MoveUndo {
+	ZobristHash m_Hash;
+	PieceType m_CapturedPiece;
+	uint8_t m_CastleRights;
+	Square m_EnPassantSquare;
+	uint8_t m_HalfMoves;
+};
+
 class Board {
 	private:
 		Bitboard m_Occupancy[2];
 		Bitboard m_Pieces[6];
+		PieceType m_Mailbox[64];
 		ZobristHash m_Hash;
+		ZobristHash m_PawnHash;
 		SideToMove m_Side;
 		uint8_t m_CastleRights;
 		Square m_enPassantSquare;
 		uint8_t m_HalfMoves;
 		Square m_Rooks[4];
 		uint8_t m_Phase;
+		PackedScore m_PsqtScore;
 		bool m_Chess960;
 
 	public:
@@ -28,9 +56,23 @@ class Board {
 
 		Board( const FEN &fen );
 
+		// The key is kept complete by MakeMove (pieces, side to move, castle rights and en passant), so reading it is free.
 		[[nodiscard]]
 		constexpr uint64_t GetHash() const {
-			ZobristHash result = m_Hash;
+			return m_Hash;
+		}
+
+		[[nodiscard]]
+		constexpr ZobristHash ComputeHash() const {
+			ZobristHash result;
+
+			for ( int piece = PAWN; piece <= KING; piece++ ) {
+				for ( const SideToMove side : { WHITE, BLACK } ) {
+					GetPieceMask( static_cast<PieceType>(piece), side ).Map( [&result, piece, side]( const Square square ) {
+						result.UpdatePieceHash( static_cast<PieceType>(piece), side, square );
+					} );
+				}
+			}
 
 			if ( m_enPassantSquare != Square( NULL_SQUARE ) ) {
 				result.UpdateEnPassantHash( m_enPassantSquare );
@@ -42,6 +84,25 @@ class Board {
 			return result;
 		}
 
+		// Pawns of both colors only, so positions that share a pawn structure share the key.
+		[[nodiscard]]
+		constexpr uint64_t GetPawnHash() const {
+			return m_PawnHash;
+		}
+
+		[[nodiscard]]
+		constexpr ZobristHash ComputePawnHash() const {
+			ZobristHash result;
+
+			for ( const SideToMove side : { WHITE, BLACK } ) {
+				GetPieceMask( PAWN, side ).Map( [&result, side]( const Square square ) {
+					result.UpdatePieceHash( PAWN, side, square );
+				} );
+			}
+
+			return result;
+		}
+
 		[[nodiscard]]
 		constexpr SideToMove GetSideToMove() const {
 			return m_Side;
@@ -68,10 +129,31 @@ class Board {
 		}
 
 		[[nodiscard]]
-		constexpr Square GetPhase() const {
+		constexpr uint8_t GetPhase() const {
 			return m_Phase;
 		}
 
+		// Material and piece-square score from white's point of view, kept up to date like the hash.
+		[[nodiscard]]
+		constexpr PackedScore GetPsqtScore() const {
+			return m_PsqtScore;
+		}
+
+		[[nodiscard]]
+		constexpr PackedScore ComputePsqtScore() const {
+			PackedScore result = 0;
+
+			for ( int piece = PAWN; piece <= KING; piece++ ) {
+				for ( const SideToMove side : { WHITE, BLACK } ) {
+					GetPieceMask( static_cast<PieceType>(piece), side ).Map( [&result, piece, side]( const Square square ) {
+						result += PSQT[side][piece][square];
+					} );
+				}
+			}
+
+			return result;
+		}
+
 		[[nodiscard]]
 		constexpr bool GetChess960() const {
 			return m_Chess960;
@@ -111,28 +193,31 @@ class Board {
 
 		[[nodiscard]]
 		constexpr PieceType GetPieceOnSquare( const Square square ) const {
-			//TODO: Test with mailbox
-			for ( int piece = PAWN; piece <= KING; piece++ ) {
-				if ( m_Pieces[piece].GetBit( square ) ) {
-					return static_cast<PieceType>(piece);
-				}
-			}
-
-			return NULL_PIECE;
+			return m_Mailbox[square];
 		}
 
 		constexpr void SetPieceOnSquare( const Square square, const PieceType piece, const SideToMove pieceColor ) {
 			m_Occupancy[pieceColor].SetBit( square );
 			m_Pieces[piece].SetBit( square );
+			m_Mailbox[square] = piece;
 			m_Hash.UpdatePieceHash( piece, pieceColor, square );
+			if ( piece == PAWN ) {
+				m_PawnHash.UpdatePieceHash( piece, pieceColor, square );
+			}
 			m_Phase += PHASE_VALUES[piece];
+			m_PsqtScore += PSQT[pieceColor][piece][square];
 		}
 
 		constexpr void RemovePieceOnSquare( const Square square, const PieceType piece, const SideToMove pieceColor ) {
 			m_Occupancy[pieceColor].PopBit( square );
 			m_Pieces[piece].PopBit( square );
+			m_Mailbox[square] = NULL_PIECE;
 			m_Hash.UpdatePieceHash( piece, pieceColor, square );
+			if ( piece == PAWN ) {
+				m_PawnHash.UpdatePieceHash( piece, pieceColor, square );
+			}
 			m_Phase -= PHASE_VALUES[piece];
+			m_PsqtScore -= PSQT[pieceColor][piece][square];
 		}
 
 		[[nodiscard]]
@@ -143,6 +228,15 @@ class Board {
 		[[nodiscard]]
 		bool IsInsufficientMaterial() const;
 
+		// Static exchange evaluation: the material the side to move wins on the target square when both sides keep
+		// recapturing with their least valuable piece and either may stand pat. Pins are ignored.
+		[[nodiscard]]
+		int32_t See( const Move &move ) const;
+
+		// Same as See( move ) >= threshold, but stops as soon as the exchange can no longer change the answer.
+		[[nodiscard]]
+		bool SeeGe( const Move &move, int32_t threshold ) const;
+
 		[[nodiscard]]
 		std::string ToString() const;
 
@@ -157,52 +251,72 @@ class Board {
 			}
 		}
 
+		constexpr void MakeMove( const Move &move, const CastleMask &castleMask, MoveUndo &undo,
+		                         DirtyPieces *dirtyPieces = nullptr ) {
+			undo.m_Hash = m_Hash;
+			undo.m_CastleRights = m_CastleRights;
+			undo.m_EnPassantSquare = m_enPassantSquare;
+			undo.m_HalfMoves = m_HalfMoves;
+
+			if ( m_Side == WHITE ) {
+				undo.m_CapturedPiece = MakeMove_Side<WHITE>( move, castleMask, dirtyPieces );
+			} else {
+				undo.m_CapturedPiece = MakeMove_Side<BLACK>( move, castleMask, dirtyPieces );
+			}
+		}
+
+		constexpr void UnmakeMove( const Move &move, const MoveUndo &undo ) {
+			if ( m_Side == WHITE ) {
+				UnmakeMove_Side<BLACK>( move, undo );
+			} else {
+				UnmakeMove_Side<WHITE>( move, undo );
+			}
+
+			m_Hash = undo.m_Hash;
+			m_CastleRights = undo.m_CastleRights;
+			m_enPassantSquare = undo.m_EnPassantSquare;
+			m_HalfMoves = undo.m_HalfMoves;
+
+			assert( m_Hash == ComputeHash() );
+			assert( m_PsqtScore == ComputePsqtScore() );
+			assert( m_PawnHash == ComputePawnHash() );
+		}
+
 	private:
 		template<SideToMove SIDE>
-		constexpr void MakeMove_Side( const Move &move, const CastleMask &castleRules ) {
+		constexpr PieceType MakeMove_Side( const Move &move, const CastleMask &castleRules,
+		                                   DirtyPieces *dirtyPieces = nullptr ) {
 			switch ( move.GetFlag() ) {
-				case QUIET_MOVE_FLAG: MakeMove_Flag<SIDE, QUIET_MOVE_FLAG>( move, castleRules );
-					break;
-				case DOUBLE_PUSH_FLAG: MakeMove_Flag<SIDE, DOUBLE_PUSH_FLAG>( move, castleRules );
-					break;
-				case KING_SIDE_CASTLE_FLAG: MakeMove_Flag<SIDE, KING_SIDE_CASTLE_FLAG>( move, castleRules );
-					break;
-				case QUEEN_SIDE_CASTLE_FLAG: MakeMove_Flag<SIDE, QUEEN_SIDE_CASTLE_FLAG>( move, castleRules );
-					break;
-				case CAPTURE_FLAG: MakeMove_Flag<SIDE, CAPTURE_FLAG>( move, castleRules );
-					break;
-				case EN_PASSANT_FLAG: MakeMove_Flag<SIDE, EN_PASSANT_FLAG>( move, castleRules );
-					break;
-				case KNIGHT_PROMOTION_FLAG: MakeMove_Flag<SIDE, KNIGHT_PROMOTION_FLAG>( move, castleRules );
-					break;
-				case BISHOP_PROMOTION_FLAG: MakeMove_Flag<SIDE, BISHOP_PROMOTION_FLAG>( move, castleRules );
-					break;
-				case ROOK_PROMOTION_FLAG: MakeMove_Flag<SIDE, ROOK_PROMOTION_FLAG>( move, castleRules );
-					break;
-				case QUEEN_PROMOTION_FLAG: MakeMove_Flag<SIDE, QUEEN_PROMOTION_FLAG>( move, castleRules );
-					break;
-				case KNIGHT_PROMOTION_CAPTURE_FLAG: MakeMove_Flag<SIDE, KNIGHT_PROMOTION_CAPTURE_FLAG>( move, castleRules );
-					break;
-				case BISHOP_PROMOTION_CAPTURE_FLAG: MakeMove_Flag<SIDE, BISHOP_PROMOTION_CAPTURE_FLAG>( move, castleRules );
-					break;
-				case ROOK_PROMOTION_CAPTURE_FLAG: MakeMove_Flag<SIDE, ROOK_PROMOTION_CAPTURE_FLAG>( move, castleRules );
-					break;
-				case QUEEN_PROMOTION_CAPTURE_FLAG: MakeMove_Flag<SIDE, QUEEN_PROMOTION_CAPTURE_FLAG>( move, castleRules );
-					break;
-				default: break;
+				case QUIET_MOVE_FLAG: return MakeMove_Flag<SIDE, QUIET_MOVE_FLAG>( move, castleRules, dirtyPieces );
+				case DOUBLE_PUSH_FLAG: return MakeMove_Flag<SIDE, DOUBLE_PUSH_FLAG>( move, castleRules, dirtyPieces );
+				case KING_SIDE_CASTLE_FLAG: return MakeMove_Flag<SIDE, KING_SIDE_CASTLE_FLAG>( move, castleRules, dirtyPieces );
+				case QUEEN_SIDE_CASTLE_FLAG: return MakeMove_Flag<SIDE, QUEEN_SIDE_CASTLE_FLAG>( move, castleRules, dirtyPieces );
+				case CAPTURE_FLAG: return MakeMove_Flag<SIDE, CAPTURE_FLAG>( move, castleRules, dirtyPieces );
+				case EN_PASSANT_FLAG: return MakeMove_Flag<SIDE, EN_PASSANT_FLAG>( move, castleRules, dirtyPieces );
+				case KNIGHT_PROMOTION_FLAG: return MakeMove_Flag<SIDE, KNIGHT_PROMOTION_FLAG>( move, castleRules, dirtyPieces );
+				case BISHOP_PROMOTION_FLAG: return MakeMove_Flag<SIDE, BISHOP_PROMOTION_FLAG>( move, castleRules, dirtyPieces );
+				case ROOK_PROMOTION_FLAG: return MakeMove_Flag<SIDE, ROOK_PROMOTION_FLAG>( move, castleRules, dirtyPieces );
+				case QUEEN_PROMOTION_FLAG: return MakeMove_Flag<SIDE, QUEEN_PROMOTION_FLAG>( move, castleRules, dirtyPieces );
+				case KNIGHT_PROMOTION_CAPTURE_FLAG: return MakeMove_Flag<SIDE, KNIGHT_PROMOTION_CAPTURE_FLAG>( move, castleRules, dirtyPieces );
+				case BISHOP_PROMOTION_CAPTURE_FLAG: return MakeMove_Flag<SIDE, BISHOP_PROMOTION_CAPTURE_FLAG>( move, castleRules, dirtyPieces );
+				case ROOK_PROMOTION_CAPTURE_FLAG: return MakeMove_Flag<SIDE, ROOK_PROMOTION_CAPTURE_FLAG>( move, castleRules, dirtyPieces );
+				case QUEEN_PROMOTION_CAPTURE_FLAG: return MakeMove_Flag<SIDE, QUEEN_PROMOTION_CAPTURE_FLAG>( move, castleRules, dirtyPieces );
+				default: return NULL_PIECE;
 			}
 		}
 
+		// Returns the captured piece so the undo record can restore it.
 		template<SideToMove SIDE, MoveFlag FLAG>
-		constexpr void MakeMove_Flag( const Move &move, const CastleMask &castleRules ) {
+		constexpr PieceType MakeMove_Flag( const Move &move, const CastleMask &castleRules, DirtyPieces *dirtyPieces ) {
 			const Square fromSquare = move.GetFromSquare();
 			const Square toSquare = move.GetToSquare();
 
 			const bool isPromotion = ( FLAG & KNIGHT_PROMOTION_FLAG ) > 0;
 			const bool isCastle = FLAG == KING_SIDE_CASTLE_FLAG || FLAG == QUEEN_SIDE_CASTLE_FLAG;
 
+			// Castles are encoded as king-takes-own-rook, so the destination never holds an enemy piece.
 			const PieceType movedPiece = GetPieceOnSquare( fromSquare );
-			const PieceType capturedPiece = GetPieceOnSquare( toSquare );
+			const PieceType capturedPiece = isCastle ? NULL_PIECE : GetPieceOnSquare( toSquare );
 
 			if ( capturedPiece != NULL_PIECE ) {
 				RemovePieceOnSquare( toSquare, capturedPiece, ~SIDE );
@@ -219,13 +333,20 @@ class Board {
 				m_HalfMoves++;
 			}
 
+			m_Hash.UpdateCastleRightsHash( m_CastleRights );
 			m_CastleRights &= ~( castleRules.GetMask( fromSquare ) | castleRules.GetMask( toSquare ) );
+			m_Hash.UpdateCastleRightsHash( m_CastleRights );
+
+			if ( m_enPassantSquare != NULL_SQUARE ) {
+				m_Hash.UpdateEnPassantHash( m_enPassantSquare );
+			}
 			m_enPassantSquare = NULL_SQUARE;
 
 			const uint8_t sideFlip = 56 * SIDE;
 			switch ( FLAG ) {
 				case DOUBLE_PUSH_FLAG:
 					m_enPassantSquare = toSquare ^ 8;
+					m_Hash.UpdateEnPassantHash( m_enPassantSquare );
 					break;
 				case QUEEN_SIDE_CASTLE_FLAG:
 					RemovePieceOnSquare( m_Rooks[SIDE * 2], ROOK, SIDE );
@@ -254,6 +375,136 @@ class Board {
 					break;
 			}
 
+			if ( dirtyPieces ) {
+				RecordDirtyPieces<SIDE, FLAG>( *dirtyPieces, move, movedPiece, capturedPiece );
+			}
+
 			m_Side = ~SIDE;
+			m_Hash.FlipSideToMoveHash();
+
+			assert( m_Hash == ComputeHash() );
+			assert( m_PsqtScore == ComputePsqtScore() );
+			assert( m_PawnHash == ComputePawnHash() );
+
+			return FLAG == EN_PASSANT_FLAG ? PAWN : capturedPiece;
+		}
+
+		// Castles read the rook origin from m_Rooks, which never changes during a game.
+		template<SideToMove SIDE, MoveFlag FLAG>
+		constexpr void RecordDirtyPieces( DirtyPieces &dirtyPieces, const Move &move, const PieceType movedPiece,
+		                                  const PieceType capturedPiece ) const {
+			const Square fromSquare = move.GetFromSquare();
+			const Square toSquare = move.GetToSquare();
+			const uint8_t sideFlip = 56 * SIDE;
+
+			dirtyPieces.m_Removed[0] = { movedPiece, SIDE, fromSquare };
+			dirtyPieces.m_RemovedCount = 1;
+			dirtyPieces.m_AddedCount = 1;
+
+			if constexpr ( FLAG == KING_SIDE_CASTLE_FLAG || FLAG == QUEEN_SIDE_CASTLE_FLAG ) {
+				const bool kingSide = FLAG == KING_SIDE_CASTLE_FLAG;
+				dirtyPieces.m_Removed[1] = { ROOK, SIDE, m_Rooks[SIDE * 2 + kingSide] };
+				dirtyPieces.m_Added[0] = { KING, SIDE, Square( sideFlip + ( kingSide ? 6 : 2 ) ) };
+				dirtyPieces.m_Added[1] = { ROOK, SIDE, Square( sideFlip + ( kingSide ? 5 : 3 ) ) };
+				dirtyPieces.m_RemovedCount = dirtyPieces.m_AddedCount = 2;
+				return;
+			}
+
+			dirtyPieces.m_Added[0] = { ( FLAG & KNIGHT_PROMOTION_FLAG ) > 0 ? move.GetPromotionPieceType() : movedPiece,
+			                           SIDE, toSquare };
+
+			if constexpr ( FLAG == EN_PASSANT_FLAG ) {
+				dirtyPieces.m_Removed[dirtyPieces.m_RemovedCount++] = { PAWN, ~SIDE, Square( toSquare ^ 8 ) };
+			} else if ( capturedPiece != NULL_PIECE ) {
+				dirtyPieces.m_Removed[dirtyPieces.m_RemovedCount++] = { capturedPiece, ~SIDE, toSquare };
+			}
+		}
+
+		template<SideToMove SIDE>
+		constexpr void UnmakeMove_Side( const Move &move, const MoveUndo &undo ) {
+			switch ( move.GetFlag() ) {
+				case QUIET_MOVE_FLAG: UnmakeMove_Flag<SIDE, QUIET_MOVE_FLAG>( move, undo );
+					break;
+				case DOUBLE_PUSH_FLAG: UnmakeMove_Flag<SIDE, DOUBLE_PUSH_FLAG>( move, undo );
+					break;
+				case KING_SIDE_CASTLE_FLAG: UnmakeMove_Flag<SIDE, KING_SIDE_CASTLE_FLAG>( move, undo );
+					break;
+				case QUEEN_SIDE_CASTLE_FLAG: UnmakeMove_Flag<SIDE, QUEEN_SIDE_CASTLE_FLAG>( move, undo );
+					break;
+				case CAPTURE_FLAG: UnmakeMove_Flag<SIDE, CAPTURE_FLAG>( move, undo );
+					break;
+				case EN_PASSANT_FLAG: UnmakeMove_Flag<SIDE, EN_PASSANT_FLAG>( move, undo );
+					break;
+				case KNIGHT_PROMOTION_FLAG: UnmakeMove_Flag<SIDE, KNIGHT_PROMOTION_FLAG>( move, undo );
+					break;
+				case BISHOP_PROMOTION_FLAG: UnmakeMove_Flag<SIDE, BISHOP_PROMOTION_FLAG>( move, undo );
+					break;
+				case ROOK_PROMOTION_FLAG: UnmakeMove_Flag<SIDE, ROOK_PROMOTION_FLAG>( move, undo );
+					break;
+				case QUEEN_PROMOTION_FLAG: UnmakeMove_Flag<SIDE, QUEEN_PROMOTION_FLAG>( move, undo );
+					break;
+				case KNIGHT_PROMOTION_CAPTURE_FLAG: UnmakeMove_Flag<SIDE, KNIGHT_PROMOTION_CAPTURE_FLAG>( move, undo );
+					break;
+				case BISHOP_PROMOTION_CAPTURE_FLAG: UnmakeMove_Flag<SIDE, BISHOP_PROMOTION_CAPTURE_FLAG>( move, undo );
+					break;
+				case ROOK_PROMOTION_CAPTURE_FLAG: UnmakeMove_Flag<SIDE, ROOK_PROMOTION_CAPTURE_FLAG>( move, undo );
+					break;
+				case QUEEN_PROMOTION_CAPTURE_FLAG: UnmakeMove_Flag<SIDE, QUEEN_PROMOTION_CAPTURE_FLAG>( move, undo );
+					break;
+				default: break;
+			}
+		}
+
+		// Mirrors MakeMove_Flag piece by piece. Hash and irreversible state are restored from the undo record afterwards.
+		template<SideToMove SIDE, MoveFlag FLAG>
+		constexpr void UnmakeMove_Flag( const Move &move, const MoveUndo &undo ) {
+			const Square fromSquare = move.GetFromSquare();
+			const Square toSquare = move.GetToSquare();
+
+			const uint8_t sideFlip = 56 * SIDE;
+			switch ( FLAG ) {
+				case QUEEN_SIDE_CASTLE_FLAG:
+					RemovePieceOnSquare( sideFlip + 2, KING, SIDE );
+					RemovePieceOnSquare( sideFlip + 3, ROOK, SIDE );
+					SetPieceOnSquare( m_Rooks[SIDE * 2], ROOK, SIDE );
+					SetPieceOnSquare( fromSquare, KING, SIDE );
+					break;
+				case KING_SIDE_CASTLE_FLAG:
+					RemovePieceOnSquare( sideFlip + 6, KING, SIDE );
+					RemovePieceOnSquare( sideFlip + 5, ROOK, SIDE );
+					SetPieceOnSquare( m_Rooks[SIDE * 2 + 1], ROOK, SIDE );
+					SetPieceOnSquare( fromSquare, KING, SIDE );
+					break;
+				case EN_PASSANT_FLAG:
+					RemovePieceOnSquare( toSquare, PAWN, SIDE );
+					SetPieceOnSquare( fromSquare, PAWN, SIDE );
+					SetPieceOnSquare( toSquare ^ 8, PAWN, ~SIDE );
+					break;
+				case KNIGHT_PROMOTION_FLAG:
+				case BISHOP_PROMOTION_FLAG:
+				case ROOK_PROMOTION_FLAG:
+				case QUEEN_PROMOTION_FLAG:
+				case KNIGHT_PROMOTION_CAPTURE_FLAG:
+				case BISHOP_PROMOTION_CAPTURE_FLAG:
+				case ROOK_PROMOTION_CAPTURE_FLAG:
+				case QUEEN_PROMOTION_CAPTURE_FLAG:
+					RemovePieceOnSquare( toSquare, move.GetPromotionPieceType(), SIDE );
+					SetPieceOnSquare( fromSquare, PAWN, SIDE );
+					if ( undo.m_CapturedPiece != NULL_PIECE ) {
+						SetPieceOnSquare( toSquare, undo.m_CapturedPiece, ~SIDE );
+					}
+					break;
+				default: {
+					const PieceType movedPiece = GetPieceOnSquare( toSquare );
+					RemovePieceOnSquare( toSquare, movedPiece, SIDE );
+					SetPieceOnSquare( fromSquare, movedPiece, SIDE );
+					if ( undo.m_CapturedPiece != NULL_PIECE ) {
+						SetPieceOnSquare( toSquare, undo.m_CapturedPiece, ~SIDE );
+					}
+					break;
+				}
+			}
+
+			m_Side = SIDE;
 		}
 };
@@ -9,6 +9,8 @@ struct CastleMask {
 		uint8_t m_Mask[64]{ };
 
 	public:
+		constexpr CastleMask() = default;
+
 		constexpr CastleMask( const Square rooks[4], const Square whiteKingSquare,
 		                      const Square blackKingSquare ) {
 			if ( rooks[0] != NULL_SQUARE ) m_Mask[rooks[0]] = 0b1000;
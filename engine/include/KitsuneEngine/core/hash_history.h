@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+#include "board.h"
+#include "../types.h"
+
+// Room for a full half-move counter of game positions before the root, plus the deepest search line.
+constexpr uint16_t MAX_HASH_HISTORY = 2 * MAX_PLY;
+
+// Hashes of the positions played since the last capture or pawn move, the current one last. Only that window can hold
+// a repetition, so scans stop at the half-move counter. Preallocated like the undo stack, one per thread.
+struct HashHistory {
+	private:
+		uint64_t m_Hashes[MAX_HASH_HISTORY];
+		uint16_t m_Size = 0;
+
+	public:
+		constexpr void Push( const uint64_t hash ) {
+			m_Hashes[m_Size++] = hash;
+		}
+
+		constexpr void Pop() {
+			m_Size--;
+		}
+
+		[[nodiscard]]
+		constexpr uint16_t GetSize() const {
+			return m_Size;
+		}
+
+		constexpr void Clear() {
+			m_Size = 0;
+		}
+
+		// Whether the current position is a draw by repetition. Positions before the root must occur three times, but
+		// one played inside the search counts once it repeats, the side that let it repeat could have done so again.
+		// ply is the current distance from the root.
+		[[nodiscard]]
+		bool IsRepetition( uint8_t halfMoves, uint16_t ply ) const;
+
+		// Whether the side to move has a reversible move back to an earlier position, which it can use to claim a draw one
+		// ply before IsRepetition sees it. Uses the cuckoo table of all single piece moves, so no move is generated.
+		[[nodiscard]]
+		bool HasUpcomingRepetition( const Board &board, uint16_t ply ) const;
+
+		// Number of piece moves in the cuckoo table, for tests.
+		[[nodiscard]]
+		static uint32_t GetCuckooMoveCount();
+};
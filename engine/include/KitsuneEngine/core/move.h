@@ -42,7 +42,7 @@ struct Move {
 
 		[[nodiscard]]
 		constexpr bool IsEnPassant() const {
-			return ( m_Value & EN_PASSANT_FLAG ) == EN_PASSANT_FLAG;
+			return GetFlag() == EN_PASSANT_FLAG;
 		}
 
 		[[nodiscard]]
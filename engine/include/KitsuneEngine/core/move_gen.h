@@ -29,6 +29,17 @@ struct MoveGenerator {
 				       : GenerateMoves_Internal<MODE, BLACK>( moves );
 		}
 
+		// Number of moves GenerateMoves would produce, summed from target bitboards without writing any Move out.
+		template<MoveGenMode MODE>
+		uint8_t CountMoves() const {
+			return m_Board.GetSideToMove() == WHITE ? CountMoves_Internal<MODE, WHITE>() : CountMoves_Internal<MODE, BLACK>();
+		}
+
+		// Whether a quiet move, such as a hash move that may come from another position, is one GenerateMoves would
+		// produce with MoveGenMode::QUIET. Checks the single move against the pin and check masks instead of generating.
+		[[nodiscard]]
+		bool IsQuietMoveLegal( Move move ) const;
+
 	private:
 		template<MoveGenMode MODE, SideToMove SIDE>
 		uint8_t GenerateMoves_Internal( Move *moves ) const {
@@ -68,6 +79,157 @@ struct MoveGenerator {
 			return static_cast<uint8_t>(moves - start);
 		}
 
+		template<MoveGenMode MODE, SideToMove SIDE>
+		uint8_t CountMoves_Internal() const {
+			const auto diagPins = m_PinMask.GetDiagonalMask();
+			const auto orthoPins = m_PinMask.GetOrthographicMask();
+			const auto captureMap = m_Board.GetOccupancy( ~SIDE );
+
+			uint32_t count = 0;
+
+			if constexpr ( MODE & MoveGenMode::QUIET ) {
+				count += ( m_KingMoveMap & ~m_Board.GetOccupancy() ).PopCount();
+			}
+
+			if constexpr ( MODE & MoveGenMode::NOISY ) {
+				count += ( m_KingMoveMap & captureMap ).PopCount();
+			}
+
+			if ( !m_Checkers ) {
+				if constexpr ( MODE & MoveGenMode::QUIET ) {
+					Move castles[2];
+					count += static_cast<uint32_t>(GetCastleMoves<SIDE>( castles ) - castles);
+				}
+
+				const auto pushMap = ~m_Board.GetOccupancy();
+
+				count += CountPawnMoves<MODE, SIDE>( pushMap, captureMap, diagPins, orthoPins );
+
+				count += CountPieceMoves<MODE, KNIGHT, SIDE>( pushMap, captureMap, diagPins, orthoPins );
+				count += CountPieceMoves<MODE, BISHOP, SIDE>( pushMap, captureMap, diagPins, orthoPins );
+				count += CountPieceMoves<MODE, ROOK, SIDE>( pushMap, captureMap, diagPins, orthoPins );
+			} else if ( !( m_Checkers & ( m_Checkers - 1 ) ) ) {
+				const auto checker = m_Checkers.Ls1bSquare();
+				const auto pushMap = Rays::GetRayExcludeDestination( m_KingSquare, checker );
+
+				count += CountPawnMoves<MODE, SIDE>( pushMap, m_Checkers, diagPins, orthoPins );
+
+				count += CountPieceMoves<MODE, KNIGHT, SIDE>( pushMap, m_Checkers, diagPins, orthoPins );
+				count += CountPieceMoves<MODE, BISHOP, SIDE>( pushMap, m_Checkers, diagPins, orthoPins );
+				count += CountPieceMoves<MODE, ROOK, SIDE>( pushMap, m_Checkers, diagPins, orthoPins );
+			}
+
+			return static_cast<uint8_t>(count);
+		}
+
+		template<MoveGenMode MODE, SideToMove SIDE>
+		uint32_t CountPawnMoves( const Bitboard pushMap, const Bitboard captureMap, const Bitboard diagPins,
+		                         const Bitboard orthoPins ) const {
+			Bitboard pawns = m_Board.GetPieceMask( PAWN, SIDE );
+			uint32_t count = 0;
+
+			if constexpr ( MODE & MoveGenMode::QUIET ) {
+				count += CountPawnPushMoves<SIDE>( pawns & ~diagPins, pushMap, orthoPins );
+			}
+
+			if constexpr ( MODE & MoveGenMode::NOISY ) {
+				if ( const Square enPassantSquare = m_Board.GetEnPassantSquare(); enPassantSquare != NULL_SQUARE ) {
+					Move enPassantMoves[2];
+					count += static_cast<uint32_t>(GetPawnEnPassantMoves<SIDE>( enPassantMoves, pawns, enPassantSquare ) -
+					                               enPassantMoves);
+				}
+
+				pawns &= ~orthoPins;
+				count += CountPawnCaptureMoves<SIDE>( pawns, captureMap, diagPins );
+				pawns &= ~diagPins;
+
+				const Bitboard promotionRank = SIDE == WHITE ? Bitboard::RANK_7 : Bitboard::RANK_2;
+				const Bitboard promotionPawns = pawns & promotionRank;
+				count += Bitboard( ( SIDE == WHITE ? promotionPawns << 8 : promotionPawns >> 8 ) & pushMap ).PopCount() * 4;
+			}
+
+			return count;
+		}
+
+		template<SideToMove SIDE>
+		uint32_t CountPawnPushMoves( Bitboard pawns, const Bitboard pushMap, const Bitboard orthoPins ) const {
+			Bitboard verticalPin = orthoPins & ( orthoPins << 8 );
+			verticalPin |= orthoPins >> 8;
+			const Bitboard notPromotionRank = SIDE == WHITE ? ~Bitboard::RANK_7 : ~Bitboard::RANK_2;
+			const Bitboard doublePushRank = SIDE == WHITE ? Bitboard::RANK_2 : Bitboard::RANK_7;
+
+			pawns &= notPromotionRank;
+			const Bitboard movablePawns = ( pawns & ~orthoPins ) | ( pawns & verticalPin );
+
+			const Bitboard singlePushMap = SIDE == WHITE ? pushMap >> 8 : pushMap << 8;
+			const Bitboard doublePushMap = SIDE == WHITE ? pushMap >> 16 : pushMap << 16;
+			const Bitboard singlePushEmptyMap = SIDE == WHITE ? ~m_Board.GetOccupancy() >> 8 : ~m_Board.GetOccupancy() << 8;
+
+			return ( movablePawns & singlePushMap ).PopCount() +
+			       ( movablePawns & doublePushRank & singlePushEmptyMap & doublePushMap ).PopCount();
+		}
+
+		// Unpinned pawns are counted a whole side at a time with shifts, pinned ones square by square.
+		template<SideToMove SIDE>
+		uint32_t CountPawnCaptureMoves( const Bitboard pawns, const Bitboard captureMap, const Bitboard diagPins ) const {
+			const Bitboard promotionRank = SIDE == WHITE ? Bitboard::RANK_7 : Bitboard::RANK_2;
+
+			const auto countCaptures = [captureMap]( const uint64_t freePawns ) -> uint32_t {
+				const uint64_t westCaptures = SIDE == WHITE
+					                              ? ( freePawns & ~Bitboard::FILE_A ) << 7
+					                              : ( freePawns & ~Bitboard::FILE_A ) >> 9;
+				const uint64_t eastCaptures = SIDE == WHITE
+					                              ? ( freePawns & ~Bitboard::FILE_H ) << 9
+					                              : ( freePawns & ~Bitboard::FILE_H ) >> 7;
+				return ( captureMap & westCaptures ).PopCount() + ( captureMap & eastCaptures ).PopCount();
+			};
+
+			uint32_t count = countCaptures( pawns & ~diagPins & ~promotionRank );
+			count += countCaptures( pawns & ~diagPins & promotionRank ) * 4;
+
+			( pawns & diagPins ).Map( [&count, captureMap, diagPins, promotionRank]( const Square fromSquare ) {
+				const uint32_t captures = ( Attacks::GetPawnAttacks( fromSquare, SIDE ) & captureMap & diagPins ).PopCount();
+				count += promotionRank.GetBit( fromSquare ) ? captures * 4 : captures;
+			} );
+
+			return count;
+		}
+
+		template<MoveGenMode MODE, PieceType PIECE, SideToMove SIDE>
+		uint32_t CountPieceMoves( const Bitboard moveMap, const Bitboard captureMap, const Bitboard diagPins,
+		                          const Bitboard orthoPins ) const {
+			Bitboard targets = Bitboard::EMPTY;
+			if constexpr ( MODE & MoveGenMode::QUIET ) {
+				targets |= moveMap;
+			}
+
+			if constexpr ( MODE & MoveGenMode::NOISY ) {
+				targets |= captureMap;
+			}
+
+			uint32_t count = 0;
+
+			if constexpr ( PIECE == KNIGHT ) {
+				( m_Board.GetPieceMask( KNIGHT, SIDE ) & ~diagPins & ~orthoPins ).Map( [&count, targets]( const Square fromSquare ) {
+					count += ( Attacks::GetKnightAttacks( fromSquare ) & targets ).PopCount();
+				} );
+			} else if constexpr ( PIECE == BISHOP ) {
+				const Bitboard pieces = ( m_Board.GetPieceMask( BISHOP, SIDE ) | m_Board.GetPieceMask( QUEEN, SIDE ) ) & ~orthoPins;
+				pieces.Map( [&count, targets, diagPins, this]( const Square fromSquare ) {
+					const Bitboard pinMask = diagPins.GetBit( fromSquare ) ? diagPins : Bitboard( Bitboard::FULL );
+					count += ( Attacks::GetBishopAttacks( fromSquare, m_Board.GetOccupancy() ) & targets & pinMask ).PopCount();
+				} );
+			} else if constexpr ( PIECE == ROOK ) {
+				const Bitboard pieces = ( m_Board.GetPieceMask( ROOK, SIDE ) | m_Board.GetPieceMask( QUEEN, SIDE ) ) & ~diagPins;
+				pieces.Map( [&count, targets, orthoPins, this]( const Square fromSquare ) {
+					const Bitboard pinMask = orthoPins.GetBit( fromSquare ) ? orthoPins : Bitboard( Bitboard::FULL );
+					count += ( Attacks::GetRookAttacks( fromSquare, m_Board.GetOccupancy() ) & targets & pinMask ).PopCount();
+				} );
+			}
+
+			return count;
+		}
+
 		template<MoveGenMode MODE>
 		Move* GetKingMoves( Move *moves, const Bitboard flippedOccupancy, const Bitboard captureMap ) const {
 			if constexpr ( MODE & MoveGenMode::QUIET ) {
@@ -194,18 +356,34 @@ struct MoveGenerator {
 			pawns &= Attacks::GetPawnAttacks( enPassantSquare, ~SIDE );
 
 			pawns.Map( [&moves, enPassantSquare, this]( const Square fromSquare ) {
-				Board temp = m_Board;
-				const auto mv = Move( fromSquare, enPassantSquare, EN_PASSANT_FLAG );
-				temp.MakeMove( mv, m_CastleMask );
-
-				if ( !Attacks::IsSquareAttacked( temp, m_Board.GetKingSquare( SIDE ), SIDE ) ) {
-					( *moves++ ) = mv;
+				if ( IsEnPassantLegal<SIDE>( fromSquare, enPassantSquare ) ) {
+					( *moves++ ) = Move( fromSquare, enPassantSquare, EN_PASSANT_FLAG );
 				}
 			} );
 
 			return moves;
 		}
 
+		// En passant clears two squares at once, so the pin mask can miss the king being exposed, either along the rank
+		// both pawns stood on or along a diagonal the captured pawn was blocking. Both slider rays are rechecked on the
+		// occupancy after the capture; leaper checks can only be answered by taking the checking pawn itself.
+		template<SideToMove SIDE>
+		bool IsEnPassantLegal( const Square fromSquare, const Square enPassantSquare ) const {
+			const Square capturedSquare = enPassantSquare ^ 8;
+			const Bitboard leapers = m_Board.GetPieceMask( KNIGHT ) | m_Board.GetPieceMask( PAWN );
+
+			if ( m_Checkers & leapers & ~Bitboard( capturedSquare ) ) {
+				return false;
+			}
+
+			const Bitboard occupancy = ( m_Board.GetOccupancy() ^ Bitboard( fromSquare ) ^ Bitboard( capturedSquare ) ) |
+			                           Bitboard( enPassantSquare );
+			const Bitboard queens = m_Board.GetPieceMask( QUEEN, ~SIDE );
+
+			return !( Attacks::GetRookAttacks( m_KingSquare, occupancy ) & ( m_Board.GetPieceMask( ROOK, ~SIDE ) | queens ) ) &&
+			       !( Attacks::GetBishopAttacks( m_KingSquare, occupancy ) & ( m_Board.GetPieceMask( BISHOP, ~SIDE ) | queens ) );
+		}
+
 		template<SideToMove SIDE>
 		Move* GetPawnCaptureMoves( Move *moves, Bitboard pawns, const Bitboard captureMap, const Bitboard diagPins ) const {
 			const Bitboard promotionRank = SIDE == WHITE ? Bitboard::RANK_7 : Bitboard::RANK_2;
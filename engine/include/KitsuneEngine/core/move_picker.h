@@ -0,0 +1,84 @@
+#pragma once
+
+#include "board.h"
+#include "move.h"
+#include "move_gen.h"
+#include "../types.h"
+
+enum class MovePickerStage : uint8_t {
+	HASH_MOVE,
+	GENERATE_NOISY,
+	NOISY,
+	GENERATE_QUIET,
+	QUIET,
+	BAD_NOISY,
+	DONE,
+};
+
+// Hands out legal moves one at a time: the hash move, then noisy moves by MVV-LVA, then quiets, then the noisy moves
+// that lose material by SEE. Each category is only generated once the previous stages are exhausted, so a cutoff on the
+// hash move or a capture never pays for quiets. Skipping quiets drops the losing noisy moves as well.
+class MovePicker {
+	private:
+		const Board &m_Board;
+		const MoveGenerator m_Generator;
+		const Move m_HashMove;
+		const bool m_SkipQuiets;
+
+		MovePickerStage m_Stage = MovePickerStage::HASH_MOVE;
+
+		Move m_NoisyMoves[MAX_MOVES];
+		int16_t m_NoisyScores[MAX_MOVES];
+		uint8_t m_NoisyCount = 0;
+		uint8_t m_NoisyIndex = 0;
+		bool m_NoisyGenerated = false;
+
+		Move m_BadNoisyMoves[MAX_MOVES];
+		uint8_t m_BadNoisyCount = 0;
+		uint8_t m_BadNoisyIndex = 0;
+
+		Move m_QuietMoves[MAX_MOVES];
+		int16_t m_QuietScores[MAX_MOVES];
+		uint8_t m_QuietCount = 0;
+		uint8_t m_QuietIndex = 0;
+		bool m_QuietGenerated = false;
+
+	public:
+		MovePicker( const Board &board, const CastleMask &castleMask, Move hashMove, bool skipQuiets = false );
+
+		// Returns a null move once every stage is exhausted.
+		[[nodiscard]]
+		Move Next();
+
+		[[nodiscard]]
+		MovePickerStage GetStage() const {
+			return m_Stage;
+		}
+
+		[[nodiscard]]
+		bool HasGeneratedNoisy() const {
+			return m_NoisyGenerated;
+		}
+
+		[[nodiscard]]
+		bool HasGeneratedQuiets() const {
+			return m_QuietGenerated;
+		}
+
+		[[nodiscard]]
+		static int16_t ScoreNoisy( const Board &board, Move move );
+
+		[[nodiscard]]
+		static int16_t ScoreQuiet( const Board &board, Move move );
+
+	private:
+		void GenerateNoisy();
+
+		void GenerateQuiets();
+
+		[[nodiscard]]
+		bool IsHashMoveLegal();
+
+		[[nodiscard]]
+		Move SelectNext( Move *moves, int16_t *scores, uint8_t count, uint8_t &index ) const;
+};
@@ -5,5 +5,16 @@
 #include "castle_mask.h"
 
 class Board;
+class PerftHashTable;
 
 uint64_t Perft( const Board &board, const CastleMask &castleMask, uint8_t depth, bool bulk, bool printSplit, bool isFirst );
+
+uint64_t PerftCopyMake( const Board &board, const CastleMask &castleMask, uint8_t depth, bool bulk );
+
+uint64_t PerftMakeUnmake( const Board &board, const CastleMask &castleMask, uint8_t depth, bool bulk );
+
+uint64_t HashedPerft( const Board &board, const CastleMask &castleMask, uint8_t depth, bool bulk, bool printSplit,
+                      PerftHashTable &table );
+
+uint64_t ParallelPerft( const Board &board, const CastleMask &castleMask, uint8_t depth, bool bulk, bool printSplit,
+                        uint32_t threadCount, PerftHashTable *table = nullptr );
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+struct PerftHashStats {
+	uint64_t m_Probes = 0;
+	uint64_t m_Hits = 0;
+	uint64_t m_Collisions = 0;
+	uint64_t m_Stores = 0;
+};
+
+// Shared (key, depth) -> node count cache. Entries are written without locks: the stored key is XORed with the data
+// word, so a torn write from two racing threads fails verification instead of returning a wrong count.
+class PerftHashTable {
+	private:
+		struct Entry {
+			std::atomic<uint64_t> m_Key;
+			std::atomic<uint64_t> m_Data;
+		};
+
+		// Slot 0 keeps the deepest subtree seen, slot 1 is always replaced.
+		struct alignas(32) Bucket {
+			Entry m_Entries[2];
+		};
+
+		// Bucket count is kept at a power of two, so indexing is a single mask.
+		std::unique_ptr<Bucket[]> m_Buckets;
+		uint64_t m_BucketCount = 0;
+
+		std::atomic<uint64_t> m_Probes = 0;
+		std::atomic<uint64_t> m_Hits = 0;
+		std::atomic<uint64_t> m_Collisions = 0;
+		std::atomic<uint64_t> m_Stores = 0;
+
+	public:
+		explicit PerftHashTable( uint32_t megabytes );
+
+		void Resize( uint32_t megabytes );
+
+		void Clear();
+
+		[[nodiscard]]
+		bool Probe( uint64_t hash, uint8_t depth, uint64_t &nodes, PerftHashStats &stats ) const;
+
+		void Store( uint64_t hash, uint8_t depth, uint64_t nodes, PerftHashStats &stats );
+
+		void MergeStats( const PerftHashStats &stats );
+
+		[[nodiscard]]
+		PerftHashStats GetStats() const;
+
+		[[nodiscard]]
+		uint64_t GetSizeInBytes() const {
+			return m_BucketCount * sizeof( Bucket );
+		}
+
+		[[nodiscard]]
+		std::string ToString() const;
+
+	private:
+		[[nodiscard]]
+		static constexpr uint64_t MixDepth( const uint64_t hash, const uint8_t depth ) {
+			return hash ^ ( 0x9E3779B97F4A7C15ull * ( depth + 1ull ) );
+		}
+
+		[[nodiscard]]
+		constexpr uint64_t GetIndex( const uint64_t key ) const {
+			return key & ( m_BucketCount - 1 );
+		}
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "board.h"
+#include "../types.h"
+
+// Preallocated per-thread storage for make/unmake, indexed by ply so the tree walk never allocates.
+struct UndoStack {
+	private:
+		MoveUndo m_Entries[MAX_PLY];
+		uint16_t m_Size = 0;
+
+	public:
+		[[nodiscard]]
+		constexpr MoveUndo& Push() {
+			return m_Entries[m_Size++];
+		}
+
+		[[nodiscard]]
+		constexpr const MoveUndo& Pop() {
+			return m_Entries[--m_Size];
+		}
+
+		[[nodiscard]]
+		constexpr uint16_t GetSize() const {
+			return m_Size;
+		}
+
+		constexpr void Clear() {
+			m_Size = 0;
+		}
+};
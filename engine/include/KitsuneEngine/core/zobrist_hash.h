@@ -18,6 +18,10 @@ struct ZobristHash {
 			m_Value ^= SEEDS[768] * sideToMove;
 		}
 
+		constexpr void FlipSideToMoveHash() {
+			m_Value ^= SEEDS[768];
+		}
+
 		constexpr void UpdateCastleRightsHash( const uint8_t rightsMask ) {
 			m_Value ^= SEEDS[769 + rightsMask];
 		}
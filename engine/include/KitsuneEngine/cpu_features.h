@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+
+class CpuFeatures {
+	public:
+		[[nodiscard]]
+		static bool HasBmi2();
+
+		// Zen 1 and Zen 2 implement PEXT in microcode (~250 cycles), which is far slower than a magic multiply.
+		[[nodiscard]]
+		static bool HasFastPext();
+
+		// Both also check that the OS saves the wider registers on context switches.
+		[[nodiscard]]
+		static bool HasAvx2();
+
+		// AVX-512 F and BW, the int16 instructions the NNUE kernels need.
+		[[nodiscard]]
+		static bool HasAvx512();
+
+		[[nodiscard]]
+		static std::string GetVendor();
+};
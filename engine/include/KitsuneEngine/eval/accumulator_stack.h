@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+
+#include "KitsuneEngine/types.h"
+#include "KitsuneEngine/core/bitboard.h"
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/eval/nnue.h"
+
+// Counted in feature rows added to or subtracted from one perspective.
+struct AccumulatorStats {
+	// What updating both perspectives on every move would have cost.
+	uint64_t m_RecordedRows = 0;
+	uint64_t m_AppliedRows = 0;
+	uint64_t m_Refreshes = 0;
+};
+
+struct AccumulatorEntry {
+	Accumulator m_Accumulator;
+	DirtyPieces m_DirtyPieces;
+	bool m_Computed[2];
+};
+
+// The last accumulator row built for a perspective and king bucket, together with the pieces it holds. Refreshing from
+// it only applies the difference to the current position, usually a few rows instead of every piece on the board.
+struct FinnyEntry {
+	alignas(64) int16_t m_Values[NNUE_HIDDEN_SIZE];
+	Bitboard m_Pieces[2][6];
+};
+
+// One accumulator per ply. Making a move only records its dirty pieces; the rows are computed when a position is
+// evaluated, by chaining the deltas from the nearest computed ply, so subtrees cut off before any evaluation cost
+// nothing. A king move into another bucket cannot be chained and is served from the Finny table instead.
+class AccumulatorStack {
+	private:
+		AccumulatorEntry m_Entries[MAX_PLY + 1];
+		uint16_t m_Size = 0;
+
+		FinnyEntry m_FinnyTable[2][NNUE_KING_BUCKETS * 2];
+		AccumulatorStats m_Stats;
+
+	public:
+		// Starts from a new root position, which is only computed once something is evaluated. Also clears the Finny
+		// table, a newly loaded network makes its rows stale.
+		void Reset();
+
+		// Pass the returned record to Board::MakeMove.
+		[[nodiscard]]
+		DirtyPieces& Push() {
+			AccumulatorEntry &entry = m_Entries[m_Size++];
+			entry.m_Computed[WHITE] = entry.m_Computed[BLACK] = false;
+			return entry.m_DirtyPieces;
+		}
+
+		void Pop() {
+			const DirtyPieces &dirtyPieces = m_Entries[--m_Size].m_DirtyPieces;
+			m_Stats.m_RecordedRows += 2 * ( dirtyPieces.m_AddedCount + dirtyPieces.m_RemovedCount );
+		}
+
+		// The board must be the position at the top of the stack.
+		[[nodiscard]]
+		int32_t Evaluate( const Board &board );
+
+		[[nodiscard]]
+		const AccumulatorStats& GetStats() const {
+			return m_Stats;
+		}
+
+	private:
+		void Update( const Board &board, SideToMove perspective );
+
+		void ApplyDelta( uint16_t ply, SideToMove perspective, Square kingSquare, bool backwards );
+
+		void RefreshFromFinnyTable( const Board &board, SideToMove perspective, int16_t *values );
+
+		[[nodiscard]]
+		static bool IsKingBucketChanged( const DirtyPieces &dirtyPieces, SideToMove perspective );
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+#include "KitsuneEngine/types.h"
+#include "KitsuneEngine/eval/pawn_hash_table.h"
+
+class Board;
+
+class Evaluation {
+	public:
+		// Material, piece-square and pawn structure score, tapered between middlegame and endgame by the board's phase.
+		// Score in centipawns from the side to move's point of view.
+		[[nodiscard]]
+		static int32_t Evaluate( const Board &board );
+
+		// Same score, with the pawn structure taken from the table.
+		[[nodiscard]]
+		static int32_t Evaluate( const Board &board, PawnHashTable &pawnTable );
+
+		// Passed, isolated and doubled pawns and the pawn attack spans, stored under the board's pawn key.
+		[[nodiscard]]
+		static PawnEntry EvaluatePawns( const Board &board );
+
+	private:
+		[[nodiscard]]
+		static int32_t Evaluate( const Board &board, const PawnEntry &pawns );
+};
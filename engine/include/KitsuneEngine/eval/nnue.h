@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "KitsuneEngine/types.h"
+#include "KitsuneEngine/core/square.h"
+
+class Board;
+
+// (768 x NNUE_KING_BUCKETS -> NNUE_HIDDEN_SIZE) x 2 -> 1 perspective network with a squared clipped ReLU. Inputs are
+// piece-square pairs seen from each side, own pieces first, ranks flipped for black and files flipped when that side's
+// king stands on the e-h files. Each perspective has its own weight set per king bucket.
+constexpr uint32_t NNUE_INPUT_SIZE = 768;
+constexpr uint32_t NNUE_KING_BUCKETS = 4;
+constexpr uint32_t NNUE_HIDDEN_SIZE = 256;
+
+// Indexed by the king square relative to its side, so rank 1 is always the home rank.
+constexpr uint8_t NNUE_KING_BUCKET_LAYOUT[64]{
+	0, 0, 1, 1, 1, 1, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+// Quantisation of the feature and output layers, and the centipawn scale the network was trained for.
+constexpr int32_t NNUE_QA = 255;
+constexpr int32_t NNUE_QB = 64;
+constexpr int32_t NNUE_SCALE = 400;
+
+// Size of a network file without the trailing padding some trainers add to reach a multiple of 64 bytes.
+constexpr size_t NNUE_NETWORK_BYTES = ( NNUE_KING_BUCKETS * NNUE_INPUT_SIZE * NNUE_HIDDEN_SIZE + NNUE_HIDDEN_SIZE +
+                                        2 * NNUE_HIDDEN_SIZE + 1 ) * sizeof( int16_t );
+
+enum class SimdLevel : uint8_t {
+	SCALAR = 0,
+	AVX2 = 1,
+	AVX512 = 2,
+};
+
+// Laid out exactly like the file: little-endian int16 feature weights, feature biases, output weights for the side to
+// move and then the other side, and the output bias.
+struct alignas(64) NnueNetwork {
+	int16_t m_FeatureWeights[NNUE_KING_BUCKETS * NNUE_INPUT_SIZE][NNUE_HIDDEN_SIZE];
+	int16_t m_FeatureBiases[NNUE_HIDDEN_SIZE];
+	int16_t m_OutputWeights[2][NNUE_HIDDEN_SIZE];
+	int16_t m_OutputBias;
+};
+
+// Hidden layer before activation, one row per perspective.
+struct alignas(64) Accumulator {
+	int16_t m_Values[2][NNUE_HIDDEN_SIZE];
+};
+
+class Nnue {
+	private:
+		static NnueNetwork s_Network;
+		static bool s_Loaded;
+
+		// Picked once at startup from the CPU features, like the slider lookup.
+		static SimdLevel s_SimdLevel;
+
+	public:
+		// Rejects files of the wrong size and networks whose output weights are too large for the int16 kernels.
+		static bool Load( const std::string &path );
+
+		static bool Load( const void *data, size_t size );
+
+		// Back to the tapered PSQT evaluation.
+		static void Unload() {
+			s_Loaded = false;
+		}
+
+		[[nodiscard]]
+		static bool IsLoaded() {
+			return s_Loaded;
+		}
+
+		[[nodiscard]]
+		static SimdLevel GetSimdLevel() {
+			return s_SimdLevel;
+		}
+
+		// Returns false if the CPU does not support the level.
+		static bool SetSimdLevel( SimdLevel level );
+
+		[[nodiscard]]
+		static std::string GetSimdLevelName();
+
+		[[nodiscard]]
+		static const int16_t* GetFeatureBiases() {
+			return s_Network.m_FeatureBiases;
+		}
+
+		// Rebuilds both rows from the biases.
+		static void Refresh( const Board &board, Accumulator &accumulator );
+
+		// output = input + the added feature rows - the removed ones, in one pass. Input and output may alias.
+		static void UpdateRow( const int16_t *input, int16_t *output, const uint32_t *added, uint32_t addedCount,
+		                       const uint32_t *removed, uint32_t removedCount );
+
+		// Score in centipawns from the side to move's point of view.
+		[[nodiscard]]
+		static int32_t Evaluate( const Accumulator &accumulator, SideToMove side );
+
+		// Builds a fresh accumulator, for one-off evaluations outside the search.
+		[[nodiscard]]
+		static int32_t Evaluate( const Board &board );
+
+		// Bucket times two plus the mirroring, the rows of two king squares with the same index use the same weights.
+		[[nodiscard]]
+		static constexpr uint32_t GetKingBucketIndex( const Square kingSquare, const SideToMove perspective ) {
+			const uint8_t relativeKing = perspective == WHITE ? static_cast<uint8_t>(kingSquare) : kingSquare.Flipped();
+			return NNUE_KING_BUCKET_LAYOUT[relativeKing] * 2 + ( kingSquare.GetFile() >= 4 );
+		}
+
+		[[nodiscard]]
+		static constexpr uint32_t GetFeatureIndex( const PieceType piece, const SideToMove pieceColor,
+		                                           const Square square, const SideToMove perspective,
+		                                           const Square kingSquare ) {
+			const uint8_t relativeSquare = square ^ ( perspective == WHITE ? 0 : 56 ) ^ ( kingSquare.GetFile() >= 4 ? 7 : 0 );
+			const uint32_t bucket = GetKingBucketIndex( kingSquare, perspective ) / 2;
+			return bucket * NNUE_INPUT_SIZE + ( pieceColor != perspective ) * 384 + piece * 64 + relativeSquare;
+		}
+};
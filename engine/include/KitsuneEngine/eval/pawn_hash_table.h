@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+#include "KitsuneEngine/core/bitboard.h"
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/eval/psqt.h"
+
+// Kept at a power of two, so indexing is a single mask.
+constexpr uint32_t PAWN_HASH_ENTRIES = 16384;
+
+// Everything derived from the pawns alone. The score is from white's point of view.
+struct PawnEntry {
+	uint64_t m_Key = 0;
+	PackedScore m_Score = 0;
+	Bitboard m_Passed[2];
+
+	// Squares a side's pawns attack now or could attack after advancing, for later terms such as outposts.
+	Bitboard m_AttackSpans[2];
+};
+
+struct PawnHashStats {
+	uint64_t m_Probes = 0;
+	uint64_t m_Hits = 0;
+};
+
+// Pawn structure only changes on pawn moves and captures of pawns, so most evaluations find it already computed under
+// the board's pawn key. One table per search thread, so there is no locking. A pawnless position has key 0, which the
+// zeroed entries already describe correctly.
+class PawnHashTable {
+	private:
+		PawnEntry m_Entries[PAWN_HASH_ENTRIES];
+		PawnHashStats m_Stats;
+
+	public:
+		// Computes and stores the entry on a miss, replacing whatever was in its slot.
+		[[nodiscard]]
+		const PawnEntry& Probe( const Board &board );
+
+		void Clear();
+
+		void ResetStats() {
+			m_Stats = { };
+		}
+
+		[[nodiscard]]
+		const PawnHashStats& GetStats() const {
+			return m_Stats;
+		}
+};
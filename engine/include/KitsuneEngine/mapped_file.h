@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// A read-only memory mapping of a whole file. Pages are only read from disk when first touched, so opening a large
+// file is cheap and lookups into it cost a few page faults at most.
+class MappedFile {
+	private:
+		const uint8_t *m_Data = nullptr;
+		size_t m_Size = 0;
+
+#if defined(_WIN32)
+		void *m_File = nullptr;
+		void *m_Mapping = nullptr;
+#endif
+
+	public:
+		MappedFile() = default;
+
+		MappedFile( const MappedFile & ) = delete;
+
+		MappedFile& operator=( const MappedFile & ) = delete;
+
+		~MappedFile() {
+			Close();
+		}
+
+		// Fails on a missing or empty file. Closes any previous mapping first. Access is expected to be random, so the
+		// system is told not to read ahead.
+		bool Open( const std::string &path );
+
+		void Close();
+
+		[[nodiscard]]
+		bool IsOpen() const {
+			return m_Data != nullptr;
+		}
+
+		[[nodiscard]]
+		const uint8_t* GetData() const {
+			return m_Data;
+		}
+
+		[[nodiscard]]
+		size_t GetSize() const {
+			return m_Size;
+		}
+};
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "KitsuneEngine/types.h"
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/core/castle_mask.h"
+#include "KitsuneEngine/core/hash_history.h"
+#include "KitsuneEngine/core/move.h"
+#include "KitsuneEngine/core/undo_stack.h"
+#include "KitsuneEngine/eval/accumulator_stack.h"
+#include "KitsuneEngine/eval/pawn_hash_table.h"
+#include "KitsuneEngine/search/transposition_table.h"
+
+constexpr uint8_t MAX_SEARCH_DEPTH = 128;
+
+constexpr int32_t INFINITE_SCORE = 32001;
+constexpr int32_t MATE_SCORE = 32000;
+constexpr int32_t MATE_BOUND = MATE_SCORE - MAX_SEARCH_DEPTH;
+constexpr int32_t DRAW_SCORE = 0;
+
+// A tablebase win, kept below every mate score so a real mate found by the search is still preferred.
+constexpr int32_t TB_WIN_SCORE = MATE_BOUND - MAX_SEARCH_DEPTH - 1;
+
+// Static evaluations stay below every tablebase score, so no heuristic position outranks a proven win.
+constexpr int32_t EVAL_BOUND = TB_WIN_SCORE - MAX_SEARCH_DEPTH - 1;
+
+// A zero node or time limit means unlimited. Without the network the PSQT evaluation is used even if one is loaded.
+struct SearchLimits {
+	uint8_t m_Depth = MAX_SEARCH_DEPTH;
+	uint64_t m_Nodes = 0;
+	uint64_t m_Milliseconds = 0;
+	bool m_UseTablebases = true;
+	bool m_UseNetwork = true;
+};
+
+// Reported after every completed iteration. The PV points into the searcher and is only valid during the callback.
+struct SearchInfo {
+	uint8_t m_Depth;
+	uint8_t m_SelDepth;
+	int32_t m_Score;
+	uint64_t m_Nodes;
+	uint64_t m_Milliseconds;
+	const Move *m_Pv;
+	uint8_t m_PvLength;
+};
+
+struct SearchResult {
+	Move m_BestMove;
+	int32_t m_Score;
+	uint8_t m_Depth;
+	uint64_t m_Nodes;
+	uint64_t m_Milliseconds;
+};
+
+using SearchReport = std::function<void( const SearchInfo & )>;
+
+// Iterative deepening principal variation search with a quiescence search over noisy moves. The tree is walked with
+// make/unmake on a single board and every buffer is a member or a stack array, so the walk itself never allocates.
+// The object is large; keep one per thread and reuse it.
+class Search {
+	private:
+		Board m_Board;
+		CastleMask m_CastleMask;
+		UndoStack m_UndoStack;
+		HashHistory m_History;
+		AccumulatorStack m_Accumulators;
+		PawnHashTable m_PawnTable;
+		TranspositionTable &m_Table;
+
+		// Index 0 is the main thread, helpers skip some iterations so threads spread over different depths.
+		const uint32_t m_ThreadIndex;
+
+		SearchLimits m_Limits;
+		std::chrono::steady_clock::time_point m_StartTime;
+		const std::atomic<bool> &m_StopSignal;
+		bool m_Stopped = false;
+
+		// Nodes of every thread searching alongside this one, checked against the node limit with the stop signal.
+		std::function<uint64_t()> m_SharedNodes;
+
+		// Written only by the searching thread, read by others for reporting.
+		std::atomic<uint64_t> m_Nodes = 0;
+		uint8_t m_RootDepth = 0;
+		uint8_t m_SelDepth = 0;
+		Move m_RootBestMove;
+
+		// Triangular PV table: row ply holds the best line found from that ply.
+		Move m_PvTable[MAX_SEARCH_DEPTH + 1][MAX_SEARCH_DEPTH + 1];
+		uint8_t m_PvLength[MAX_SEARCH_DEPTH + 1];
+
+	public:
+		// The stop signal is raised by another thread; the search notices it within a few thousand nodes.
+		Search( TranspositionTable &table, const std::atomic<bool> &stopSignal, uint32_t threadIndex = 0 );
+
+		// The caller ages the table with TranspositionTable::NewSearch, as one table is shared by all threads. The history
+		// holds the hashes of the game positions before the root, oldest first, for repetition detection.
+		SearchResult Run( const Board &board, const SearchLimits &limits, const SearchReport &report = nullptr,
+		                  const std::vector<uint64_t> &history = { } );
+
+		[[nodiscard]]
+		const AccumulatorStats& GetAccumulatorStats() const {
+			return m_Accumulators.GetStats();
+		}
+
+		[[nodiscard]]
+		const PawnHashStats& GetPawnHashStats() const {
+			return m_PawnTable.GetStats();
+		}
+
+		[[nodiscard]]
+		uint64_t GetNodes() const {
+			return m_Nodes.load( std::memory_order_relaxed );
+		}
+
+		void SetSharedNodes( std::function<uint64_t()> sharedNodes ) {
+			m_SharedNodes = std::move( sharedNodes );
+		}
+
+		// UCI form: "cp <centipawns>" or "mate <moves>", negative when the side to move is mated.
+		[[nodiscard]]
+		static std::string ScoreToString( int32_t score );
+
+	private:
+		template<bool PV_NODE>
+		int32_t Negamax( int32_t alpha, int32_t beta, int32_t depth, uint8_t ply );
+
+		int32_t Quiescence( int32_t alpha, int32_t beta, uint8_t ply );
+
+		// The network when one is loaded and the limits allow it, the tapered PSQT evaluation otherwise.
+		[[nodiscard]]
+		int32_t Evaluate();
+
+		void CountNode() {
+			m_Nodes.store( m_Nodes.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+		}
+
+		[[nodiscard]]
+		bool IsDepthSkipped( uint8_t depth ) const;
+
+		void UpdatePv( Move move, uint8_t ply );
+
+		[[nodiscard]]
+		bool ShouldStop();
+
+		[[nodiscard]]
+		uint64_t GetElapsedMilliseconds() const;
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "KitsuneEngine/thread_pool.h"
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/search/search.h"
+#include "KitsuneEngine/search/transposition_table.h"
+
+// Lazy SMP: every thread runs its own iterative deepening on a copy of the root board and they only cooperate through
+// the shared transposition table. The main thread owns the limits and reporting, helpers run until it is done.
+class SearchPool {
+	private:
+		TranspositionTable &m_Table;
+		std::atomic<bool> m_StopSignal = false;
+
+		std::vector<std::unique_ptr<Search>> m_Searches;
+		std::vector<SearchResult> m_Results;
+		std::vector<uint64_t> m_History;
+		std::unique_ptr<ThreadPool> m_Threads;
+
+	public:
+		SearchPool( TranspositionTable &table, uint32_t threadCount );
+
+		// Not safe while a search is running.
+		void SetThreadCount( uint32_t threadCount );
+
+		[[nodiscard]]
+		uint32_t GetThreadCount() const {
+			return static_cast<uint32_t>(m_Searches.size());
+		}
+
+		// Returns immediately; the search runs on the pool's threads until its limits are hit or Stop is called.
+		// Reported node counts are summed over all threads, and so is the node limit. With helpers each thread checks the
+		// total every 1024 of its own nodes, so it can be passed by about that much per thread. The history is as for Search::Run.
+		void Start( const Board &board, const SearchLimits &limits, SearchReport report = nullptr,
+		            std::vector<uint64_t> history = { } );
+
+		// Blocks until every thread finished and returns the result of the thread that completed the deepest iteration.
+		SearchResult Wait();
+
+		SearchResult Run( const Board &board, const SearchLimits &limits, SearchReport report = nullptr,
+		                  std::vector<uint64_t> history = { } ) {
+			Start( board, limits, std::move( report ), std::move( history ) );
+			return Wait();
+		}
+
+		void Stop() {
+			m_StopSignal.store( true, std::memory_order_relaxed );
+		}
+
+		[[nodiscard]]
+		uint64_t GetNodes() const;
+};
@@ -0,0 +1,103 @@
+#pragma once
+
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#endif
+
+#include <atomic>
+#include <cstdint>
+
+#include "KitsuneEngine/core/move.h"
+
+enum class TTBound : uint8_t {
+	NONE = 0,
+	UPPER = 1,
+	LOWER = 2,
+	EXACT = 3,
+};
+
+struct TTData {
+	Move m_Move;
+	int32_t m_Score;
+	uint8_t m_Depth;
+	TTBound m_Bound;
+};
+
+// Shared by every search thread. Entries are written without locks: the stored key is XORed with the data word, so a
+// torn write from two racing threads fails verification instead of returning another position's data.
+class TranspositionTable {
+	private:
+		struct Entry {
+			std::atomic<uint64_t> m_Key;
+			std::atomic<uint64_t> m_Data;
+		};
+
+		// One cache line per bucket, so a probe touches a single line.
+		struct alignas(64) Bucket {
+			Entry m_Entries[4];
+		};
+
+		// Bucket count is kept at a power of two, so indexing is a single mask.
+		Bucket *m_Buckets = nullptr;
+		uint64_t m_BucketCount = 0;
+		uint64_t m_AllocatedBytes = 0;
+
+		// Bumped for every new search so entries from earlier searches are replaced first.
+		uint8_t m_Age = 0;
+
+	public:
+		explicit TranspositionTable( uint32_t megabytes );
+
+		~TranspositionTable();
+
+		TranspositionTable( const TranspositionTable & ) = delete;
+
+		TranspositionTable& operator=( const TranspositionTable & ) = delete;
+
+		// Not safe while a search is running. Returns false if the memory could not be allocated, the table then keeps
+		// its previous size, or the largest smaller one that fits.
+		bool Resize( uint32_t megabytes );
+
+		// Splits the table between threads, first-touching each part from the thread that clears it.
+		void Clear( uint32_t threadCount = 1 );
+
+		void NewSearch() {
+			m_Age = ( m_Age + 1 ) & AGE_MASK;
+		}
+
+		// Mate and tablebase scores are stored relative to the probing node, ply converts them back to root-relative ones.
+		[[nodiscard]]
+		bool Probe( uint64_t hash, uint8_t ply, TTData &data ) const;
+
+		void Store( uint64_t hash, Move move, int32_t score, uint8_t depth, TTBound bound, uint8_t ply );
+
+		void Prefetch( const uint64_t hash ) const {
+#if defined(_MSC_VER)
+			_mm_prefetch( reinterpret_cast<const char*>(&m_Buckets[GetIndex( hash )]), _MM_HINT_T0 );
+#else
+			__builtin_prefetch( &m_Buckets[GetIndex( hash )] );
+#endif
+		}
+
+		// Permille of sampled entries written during the current search, as UCI reports it.
+		[[nodiscard]]
+		uint32_t GetHashfull() const;
+
+		[[nodiscard]]
+		uint64_t GetSizeInBytes() const {
+			return m_BucketCount * sizeof( Bucket );
+		}
+
+	private:
+		static constexpr uint8_t AGE_MASK = 0x3F;
+
+		[[nodiscard]]
+		constexpr uint64_t GetIndex( const uint64_t hash ) const {
+			return hash & ( m_BucketCount - 1 );
+		}
+
+		[[nodiscard]]
+		bool Allocate( uint64_t bucketCount );
+
+		void Free();
+};
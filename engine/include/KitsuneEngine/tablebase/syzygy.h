@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/core/move.h"
+
+// Tables exist for up to seven pieces, kings included.
+constexpr uint8_t SYZYGY_MAX_PIECES = 7;
+
+// From the side to move's point of view. Cursed wins and blessed losses are the results the fifty-move rule turns into
+// draws.
+enum class WdlScore : int8_t {
+	LOSS = -2,
+	BLESSED_LOSS = -1,
+	DRAW = 0,
+	CURSED_WIN = 1,
+	WIN = 2,
+};
+
+// Counted over all threads since the last reset. Only the outermost probe of each call is counted.
+struct SyzygyStats {
+	uint64_t m_WdlProbes = 0;
+	uint64_t m_WdlHits = 0;
+	uint64_t m_DtzProbes = 0;
+	uint64_t m_DtzHits = 0;
+};
+
+// Syzygy endgame tablebases read from local .rtbw (win/draw/loss) and .rtbz (distance to zeroing) files. Init only
+// registers the files found; each one is memory-mapped and its headers parsed the first time a position needs it, under
+// a lock so concurrent searches can trigger it safely. Probes are read-only afterwards and need no locking.
+class Syzygy {
+	private:
+		static uint8_t s_MaxPieces;
+
+	public:
+		// Directories are separated by ';' on Windows and ':' elsewhere. Replaces any tables found before, so no search
+		// may be running. Returns the number of WDL tables found.
+		static uint32_t Init( const std::string &paths );
+
+		static void Free();
+
+		// Piece count of the largest table found, zero without tables.
+		[[nodiscard]]
+		static uint8_t GetMaxPieces() {
+			return s_MaxPieces;
+		}
+
+		// The cheap test to run before probing: few enough pieces on the board and no castling rights, which the tables do
+		// not encode.
+		[[nodiscard]]
+		static bool CanProbe( const Board &board ) {
+			return board.GetOccupancy().PopCount() <= s_MaxPieces && !board.CanCastle( CASTLE_WHITE_KING ) &&
+			       !board.CanCastle( CASTLE_WHITE_QUEEN ) && !board.CanCastle( CASTLE_BLACK_KING ) &&
+			       !board.CanCastle( CASTLE_BLACK_QUEEN );
+		}
+
+		// Assumes the fifty-move counter was just reset, so it is only exact after a capture or a pawn move. Returns false
+		// when a table is missing.
+		[[nodiscard]]
+		static bool ProbeWdl( const Board &board, WdlScore &score );
+
+		// Plies to the next capture or pawn move with best play, positive when winning, negative when losing and zero for a
+		// draw. Cursed wins and blessed losses are counted past 100. Off by one ply at most, like the tables themselves.
+		[[nodiscard]]
+		static bool ProbeDtz( const Board &board, int32_t &dtz );
+
+		// Picks the root move that keeps the best result reachable under the fifty-move rule, given the board's half-move
+		// counter: the fastest conversion when winning, the longest resistance when losing. Needs the DTZ tables.
+		[[nodiscard]]
+		static bool ProbeRoot( const Board &board, Move &move, WdlScore &score );
+
+		[[nodiscard]]
+		static SyzygyStats GetStats();
+
+		static void ResetStats();
+};
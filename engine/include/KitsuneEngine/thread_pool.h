@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using Task = std::function<void()>;
+
+class ThreadPool {
+	private:
+		struct WorkQueue {
+			std::mutex m_Mutex;
+			std::deque<Task> m_Tasks;
+		};
+
+		std::vector<std::unique_ptr<WorkQueue>> m_Queues;
+		std::vector<std::jthread> m_Threads;
+		std::atomic<uint64_t> m_QueuedTasks = 0;
+		std::atomic<uint64_t> m_PendingTasks = 0;
+		std::atomic<uint32_t> m_NextQueue = 0;
+		std::mutex m_SignalMutex;
+		std::condition_variable m_WorkSignal;
+		std::condition_variable m_DoneSignal;
+		bool m_Stopping = false;
+
+	public:
+		explicit ThreadPool( uint32_t threadCount );
+
+		~ThreadPool();
+
+		ThreadPool( const ThreadPool & ) = delete;
+
+		ThreadPool& operator=( const ThreadPool & ) = delete;
+
+		// Called from a worker, the task lands on that worker's own queue (LIFO for the owner, FIFO for thieves),
+		// otherwise queues are filled round-robin.
+		void Submit( Task task );
+
+		void Wait();
+
+		[[nodiscard]]
+		uint32_t GetThreadCount() const {
+			return static_cast<uint32_t>(m_Threads.size());
+		}
+
+	private:
+		void WorkerLoop( uint32_t index );
+
+		bool TryPop( uint32_t index, Task &task );
+
+		bool TrySteal( uint32_t index, Task &task );
+};
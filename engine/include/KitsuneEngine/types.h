@@ -47,8 +47,13 @@ enum CastleRightsFlag : uint8_t {
 
 static constexpr uint8_t PHASE_VALUES[6]{ 0, 1, 1, 2, 4, 0 };
 
+// Indexed by PieceType, NULL_PIECE included. The king is never captured, its value is never used.
+static constexpr int32_t SEE_VALUES[7]{ 100, 300, 300, 500, 900, 0, 0 };
+
 constexpr uint8_t MAX_MOVES = 218;
 
+constexpr uint16_t MAX_PLY = 256;
+
 enum class MoveGenMode : uint8_t {
 	NOISY = 0b01,
 	QUIET = 0b10,
@@ -0,0 +1,129 @@
+#include "KitsuneEngine/book/polyglot_book.h"
+
+#include "KitsuneEngine/book/polyglot_key.h"
+#include "KitsuneEngine/core/move_gen.h"
+
+static uint64_t ReadBigEndian( const uint8_t *data, const uint32_t bytes ) {
+	uint64_t value = 0;
+	for ( uint32_t i = 0; i < bytes; i++ ) {
+		value = value << 8 | data[i];
+	}
+
+	return value;
+}
+
+bool PolyglotBook::Open( const std::string &path ) {
+	Close();
+	if ( !m_File.Open( path ) ) {
+		return false;
+	}
+
+	if ( m_File.GetSize() % POLYGLOT_ENTRY_BYTES != 0 ) {
+		m_File.Close();
+		return false;
+	}
+
+	m_EntryCount = m_File.GetSize() / POLYGLOT_ENTRY_BYTES;
+	return true;
+}
+
+void PolyglotBook::Close() {
+	m_File.Close();
+	m_EntryCount = 0;
+}
+
+PolyglotEntry PolyglotBook::GetEntry( const uint64_t index ) const {
+	const uint8_t *entry = m_File.GetData() + index * POLYGLOT_ENTRY_BYTES;
+	return {
+		ReadBigEndian( entry, 8 ),
+		static_cast<uint16_t>(ReadBigEndian( entry + 8, 2 )),
+		static_cast<uint16_t>(ReadBigEndian( entry + 10, 2 )),
+		static_cast<uint32_t>(ReadBigEndian( entry + 12, 4 )),
+	};
+}
+
+// Lower bound on the key, then a forward scan over its few entries. Only the keys are decoded along the way.
+std::pair<uint64_t, uint64_t> PolyglotBook::FindEntries( const uint64_t key ) const {
+	uint64_t first = 0;
+	uint64_t count = m_EntryCount;
+	while ( count > 0 ) {
+		const uint64_t half = count / 2;
+		if ( ReadBigEndian( m_File.GetData() + ( first + half ) * POLYGLOT_ENTRY_BYTES, 8 ) < key ) {
+			first += half + 1;
+			count -= half + 1;
+		} else {
+			count = half;
+		}
+	}
+
+	uint64_t last = first;
+	while ( last < m_EntryCount && ReadBigEndian( m_File.GetData() + last * POLYGLOT_ENTRY_BYTES, 8 ) == key ) {
+		last++;
+	}
+
+	return { first, last };
+}
+
+Move PolyglotBook::Probe( const Board &board, const uint64_t random ) const {
+	return Probe( board, PolyglotKey::Compute( board ), random );
+}
+
+Move PolyglotBook::Probe( const Board &board, const uint64_t key, const uint64_t random ) const {
+	if ( !IsOpen() ) {
+		return { };
+	}
+
+	const auto [first, last] = FindEntries( key );
+	if ( first == last ) {
+		return { };
+	}
+
+	Move moves[MAX_MOVES];
+	const uint8_t count = MoveGenerator( board, board.GenerateCastleMask() ).GenerateMoves<MoveGenMode::ALL>( moves );
+
+	Move candidates[MAX_MOVES];
+	uint32_t weights[MAX_MOVES];
+	uint32_t candidateCount = 0;
+	uint64_t totalWeight = 0;
+	for ( uint64_t i = first; i < last && candidateCount < MAX_MOVES; i++ ) {
+		const PolyglotEntry entry = GetEntry( i );
+		if ( entry.m_Weight == 0 ) {
+			continue;
+		}
+
+		const std::string moveString = GetMoveString( entry.m_Move );
+		for ( uint8_t j = 0; j < count; j++ ) {
+			if ( moves[j].ToString( true ) == moveString ) {
+				candidates[candidateCount] = moves[j];
+				weights[candidateCount++] = entry.m_Weight;
+				totalWeight += entry.m_Weight;
+				break;
+			}
+		}
+	}
+
+	if ( totalWeight == 0 ) {
+		return { };
+	}
+
+	uint64_t pick = random % totalWeight;
+	for ( uint32_t i = 0; i < candidateCount; i++ ) {
+		if ( pick < weights[i] ) {
+			return candidates[i];
+		}
+		pick -= weights[i];
+	}
+
+	return { };
+}
+
+std::string PolyglotBook::GetMoveString( const uint16_t bookMove ) {
+	std::string result = Square( bookMove >> 6 & 63 ).ToString() + Square( bookMove & 63 ).ToString();
+
+	const uint16_t promotion = bookMove >> 12 & 7;
+	if ( promotion > 0 && promotion <= 4 ) {
+		result += " nbrq"[promotion];
+	}
+
+	return result;
+}
@@ -1,7 +1,78 @@
 #include "KitsuneEngine/core/attacks/attacks.h"
 
+#include "KitsuneEngine/cpu_features.h"
 #include "KitsuneEngine/core/board.h"
 
+static constexpr int8_t ROOK_DIRECTIONS[4][2]{ { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+static constexpr int8_t BISHOP_DIRECTIONS[4][2]{ { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+
+SliderLookup Attacks::s_SliderLookup = SliderLookup::MAGIC;
+Bitboard Attacks::s_RookAttacks[ROOK_TABLE_SIZE];
+Bitboard Attacks::s_BishopAttacks[BISHOP_TABLE_SIZE];
+
+static SliderLookup SelectSliderLookup() {
+	return CpuFeatures::HasFastPext() ? SliderLookup::PEXT : SliderLookup::MAGIC;
+}
+
+[[maybe_unused]] static const bool s_SliderTablesReady = Attacks::SetSliderLookup( SelectSliderLookup() );
+
+static uint64_t WalkSliderAttacks( const int square, const uint64_t occupancy, const int8_t ( &directions )[4][2] ) {
+	uint64_t result = 0;
+
+	for ( const auto &direction : directions ) {
+		int rank = square / 8 + direction[0];
+		int file = square % 8 + direction[1];
+
+		for ( ; rank >= 0 && rank < 8 && file >= 0 && file < 8; rank += direction[0], file += direction[1] ) {
+			const uint64_t bit = 1ull << ( rank * 8 + file );
+			result |= bit;
+
+			if ( occupancy & bit ) {
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+// Carry-rippler enumeration visits the subsets of a mask in the order of their compressed bits, so the n-th subset
+// is exactly the one PEXT maps to index n and no BMI2 instruction is needed to build the PEXT layout.
+static void FillSliderTable( Bitboard *table, const uint64_t ( &masks )[64], const uint64_t ( &magics )[64],
+                             const uint8_t ( &counts )[64], const uint32_t ( &offsets )[64],
+                             const int8_t ( &directions )[4][2], const SliderLookup lookup ) {
+	for ( int square = 0; square < 64; square++ ) {
+		const uint64_t mask = masks[square];
+		uint64_t subset = 0;
+		uint64_t order = 0;
+
+		do {
+			const uint64_t index = lookup == SliderLookup::PEXT ? order : subset * magics[square] >> ( 64 - counts[square] );
+			table[offsets[square] + index] = WalkSliderAttacks( square, subset, directions );
+
+			subset = ( subset - mask ) & mask;
+			order++;
+		} while ( subset );
+	}
+}
+
+bool Attacks::SetSliderLookup( const SliderLookup lookup ) {
+	if ( lookup == SliderLookup::PEXT && !CpuFeatures::HasBmi2() ) {
+		return false;
+	}
+
+	FillSliderTable( s_RookAttacks, ROOK_MASKS, ROOK_MAGICS, ROOK_OCCUPANCY_COUNT, ROOK_OFFSETS, ROOK_DIRECTIONS, lookup );
+	FillSliderTable( s_BishopAttacks, BISHOP_MASKS, BISHOP_MAGICS, BISHOP_OCCUPANCY_COUNT, BISHOP_OFFSETS,
+	                 BISHOP_DIRECTIONS, lookup );
+
+	s_SliderLookup = lookup;
+	return true;
+}
+
+std::string Attacks::GetSliderLookupName() {
+	return s_SliderLookup == SliderLookup::PEXT ? "PEXT (BMI2)" : "Magic Bitboards";
+}
+
 bool Attacks::IsInCheck( const Board &board ) {
 	return IsSquareAttacked( board, board.GetKingSquare( board.GetSideToMove() ), board.GetSideToMove() );
 }
@@ -30,6 +101,16 @@ Bitboard Attacks::AllAttackersToSquare( const Board &board, const Square square,
 	       GetOccupancy( ~defenderSide );
 }
 
+Bitboard Attacks::AllAttackersToSquare( const Board &board, const Square square, const Bitboard occupancy ) {
+	const auto queens = board.GetPieceMask( QUEEN );
+	return ( GetKnightAttacks( square ) & board.GetPieceMask( KNIGHT ) ) |
+	       ( GetKingAttacks( square ) & board.GetPieceMask( KING ) ) |
+	       ( GetPawnAttacks( square, WHITE ) & board.GetPieceMask( PAWN, BLACK ) ) |
+	       ( GetPawnAttacks( square, BLACK ) & board.GetPieceMask( PAWN, WHITE ) ) |
+	       ( GetRookAttacks( square, occupancy ) & ( board.GetPieceMask( ROOK ) | queens ) ) |
+	       ( GetBishopAttacks( square, occupancy ) & ( board.GetPieceMask( BISHOP ) | queens ) );
+}
+
 Bitboard Attacks::GenerateAttackMap( const Board &board, const SideToMove defenderSide ) {
 	auto result = Bitboard::EMPTY;
 
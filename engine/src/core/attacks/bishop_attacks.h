@@ -1,6 +1,5 @@
 #pragma once
 
-#if !PEXT
 #include <cstdint>
 static constexpr uint8_t BISHOP_OCCUPANCY_COUNT[64]{
 	0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x7, 0x7, 0x7, 0x7, 0x5,
@@ -20,7 +19,17 @@ static constexpr uint64_t BISHOP_MAGICS[64]{
 	0x408100408304489, 0x2121011200810000, 0x1124220100884045, 0x41000202060a0321, 0x4000020104c800, 0x63010b0411085,
 	0x202408008210101, 0x800004050020888, 0x442418184501, 0x4041020089010a,
 };
-#endif
+
+static constexpr uint32_t BISHOP_OFFSETS[64]{
+	0, 64, 96, 128, 160, 192, 224, 256, 320, 352, 384, 416,
+	448, 480, 512, 544, 576, 608, 640, 768, 896, 1024, 1152, 1184,
+	1216, 1248, 1280, 1408, 1920, 2432, 2560, 2592, 2624, 2656, 2688, 2816,
+	3328, 3840, 3968, 4000, 4032, 4064, 4096, 4224, 4352, 4480, 4608, 4640,
+	4672, 4704, 4736, 4768, 4800, 4832, 4864, 4896, 4928, 4992, 5024, 5056,
+	5088, 5120, 5152, 5184,
+};
+
+static constexpr uint32_t BISHOP_TABLE_SIZE = 5248;
 
 static constexpr uint64_t BISHOP_MASKS[64]{
 	0x40201008040200, 0x402010080400, 0x4020100a00, 0x40221400, 0x2442800, 0x204085000, 0x20408102000, 0x2040810204000,
@@ -1,591 +1,42 @@
 #pragma once
 
-static constexpr uint64_t RAYS[4096]{
-	0x0, 0x2, 0x6, 0xe, 0x1e, 0x3e, 0x7e, 0xfe, 0x100, 0x200, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10100, 0x0, 0x40200, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x1010100, 0x0, 0x0, 0x8040200, 0x0, 0x0, 0x0, 0x0, 0x101010100, 0x0, 0x0, 0x0, 0x1008040200,
-	0x0, 0x0, 0x0, 0x10101010100, 0x0, 0x0, 0x0, 0x0, 0x201008040200, 0x0, 0x0, 0x1010101010100, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x40201008040200, 0x0, 0x101010101010100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8040201008040200, 0x1, 0x0, 0x4, 0xc,
-	0x1c, 0x3c, 0x7c, 0xfc, 0x100, 0x200, 0x400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20200, 0x0, 0x80400, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x2020200, 0x0, 0x0, 0x10080400, 0x0, 0x0, 0x0, 0x0, 0x202020200, 0x0, 0x0, 0x0, 0x2010080400, 0x0, 0x0,
-	0x0, 0x20202020200, 0x0, 0x0, 0x0, 0x0, 0x402010080400, 0x0, 0x0, 0x2020202020200, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x80402010080400, 0x0, 0x202020202020200, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x2, 0x0, 0x8, 0x18, 0x38, 0x78, 0xf8,
-	0x0, 0x200, 0x400, 0x800, 0x0, 0x0, 0x0, 0x0, 0x10200, 0x0, 0x40400, 0x0, 0x100800, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x4040400, 0x0, 0x0, 0x20100800, 0x0, 0x0, 0x0, 0x0, 0x404040400, 0x0, 0x0, 0x0, 0x4020100800, 0x0, 0x0, 0x0,
-	0x40404040400, 0x0, 0x0, 0x0, 0x0, 0x804020100800, 0x0, 0x0, 0x4040404040400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x404040404040400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x6, 0x4, 0x0, 0x10, 0x30, 0x70, 0xf0, 0x0, 0x0, 0x400, 0x800,
-	0x1000, 0x0, 0x0, 0x0, 0x0, 0x20400, 0x0, 0x80800, 0x0, 0x201000, 0x0, 0x0, 0x1020400, 0x0, 0x0, 0x8080800, 0x0,
-	0x0, 0x40201000, 0x0, 0x0, 0x0, 0x0, 0x808080800, 0x0, 0x0, 0x0, 0x8040201000, 0x0, 0x0, 0x0, 0x80808080800, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8080808080800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x808080808080800, 0x0, 0x0, 0x0,
-	0x0, 0xf, 0xe, 0xc, 0x8, 0x0, 0x20, 0x60, 0xe0, 0x0, 0x0, 0x0, 0x800, 0x1000, 0x2000, 0x0, 0x0, 0x0, 0x0, 0x40800,
-	0x0, 0x101000, 0x0, 0x402000, 0x0, 0x0, 0x2040800, 0x0, 0x0, 0x10101000, 0x0, 0x0, 0x80402000, 0x102040800, 0x0,
-	0x0, 0x0, 0x1010101000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101010101000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x10101010101000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010101010101000, 0x0, 0x0, 0x0, 0x1f, 0x1e, 0x1c, 0x18,
-	0x10, 0x0, 0x40, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1000, 0x2000, 0x4000, 0x0, 0x0, 0x0, 0x0, 0x81000, 0x0, 0x202000, 0x0,
-	0x804000, 0x0, 0x0, 0x4081000, 0x0, 0x0, 0x20202000, 0x0, 0x0, 0x0, 0x204081000, 0x0, 0x0, 0x0, 0x2020202000, 0x0,
-	0x0, 0x10204081000, 0x0, 0x0, 0x0, 0x0, 0x202020202000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20202020202000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2020202020202000, 0x0, 0x0, 0x3f, 0x3e, 0x3c, 0x38, 0x30, 0x20, 0x0, 0x80, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x2000, 0x4000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x102000, 0x0, 0x404000, 0x0, 0x0, 0x0, 0x0, 0x8102000,
-	0x0, 0x0, 0x40404000, 0x0, 0x0, 0x0, 0x408102000, 0x0, 0x0, 0x0, 0x4040404000, 0x0, 0x0, 0x20408102000, 0x0, 0x0,
-	0x0, 0x0, 0x404040404000, 0x0, 0x1020408102000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40404040404000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x4040404040404000, 0x0, 0x7f, 0x7e, 0x7c, 0x78, 0x70, 0x60, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x4000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x204000, 0x0, 0x808000, 0x0, 0x0, 0x0, 0x0, 0x10204000, 0x0, 0x0,
-	0x80808000, 0x0, 0x0, 0x0, 0x810204000, 0x0, 0x0, 0x0, 0x8080808000, 0x0, 0x0, 0x40810204000, 0x0, 0x0, 0x0, 0x0,
-	0x808080808000, 0x0, 0x2040810204000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80808080808000, 0x102040810204000, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x8080808080808000, 0x1, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x200, 0x600, 0xe00, 0x1e00, 0x3e00,
-	0x7e00, 0xfe00, 0x10000, 0x20000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010000, 0x0, 0x4020000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x101010000, 0x0, 0x0, 0x804020000, 0x0, 0x0, 0x0, 0x0, 0x10101010000, 0x0, 0x0, 0x0, 0x100804020000, 0x0, 0x0, 0x0,
-	0x1010101010000, 0x0, 0x0, 0x0, 0x0, 0x20100804020000, 0x0, 0x0, 0x101010101010000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x4020100804020000, 0x0, 0x1, 0x2, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x0, 0x400, 0xc00, 0x1c00, 0x3c00, 0x7c00,
-	0xfc00, 0x10000, 0x20000, 0x40000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2020000, 0x0, 0x8040000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x202020000, 0x0, 0x0, 0x1008040000, 0x0, 0x0, 0x0, 0x0, 0x20202020000, 0x0, 0x0, 0x0, 0x201008040000, 0x0, 0x0,
-	0x0, 0x2020202020000, 0x0, 0x0, 0x0, 0x0, 0x40201008040000, 0x0, 0x0, 0x202020202020000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x8040201008040000, 0x0, 0x2, 0x4, 0x8, 0x0, 0x0, 0x0, 0x0, 0x300, 0x200, 0x0, 0x800, 0x1800, 0x3800, 0x7800,
-	0xf800, 0x0, 0x20000, 0x40000, 0x80000, 0x0, 0x0, 0x0, 0x0, 0x1020000, 0x0, 0x4040000, 0x0, 0x10080000, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x404040000, 0x0, 0x0, 0x2010080000, 0x0, 0x0, 0x0, 0x0, 0x40404040000, 0x0, 0x0, 0x0,
-	0x402010080000, 0x0, 0x0, 0x0, 0x4040404040000, 0x0, 0x0, 0x0, 0x0, 0x80402010080000, 0x0, 0x0, 0x404040404040000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8, 0x10, 0x0, 0x0, 0x0, 0x700, 0x600, 0x400, 0x0, 0x1000, 0x3000, 0x7000,
-	0xf000, 0x0, 0x0, 0x40000, 0x80000, 0x100000, 0x0, 0x0, 0x0, 0x0, 0x2040000, 0x0, 0x8080000, 0x0, 0x20100000, 0x0,
-	0x0, 0x102040000, 0x0, 0x0, 0x808080000, 0x0, 0x0, 0x4020100000, 0x0, 0x0, 0x0, 0x0, 0x80808080000, 0x0, 0x0, 0x0,
-	0x804020100000, 0x0, 0x0, 0x0, 0x8080808080000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x808080808080000, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x8, 0x10, 0x20, 0x0, 0x0, 0xf00, 0xe00, 0xc00, 0x800, 0x0, 0x2000, 0x6000, 0xe000, 0x0, 0x0,
-	0x0, 0x80000, 0x100000, 0x200000, 0x0, 0x0, 0x0, 0x0, 0x4080000, 0x0, 0x10100000, 0x0, 0x40200000, 0x0, 0x0,
-	0x204080000, 0x0, 0x0, 0x1010100000, 0x0, 0x0, 0x8040200000, 0x10204080000, 0x0, 0x0, 0x0, 0x101010100000, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x10101010100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010101010100000, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x10, 0x20, 0x40, 0x0, 0x1f00, 0x1e00, 0x1c00, 0x1800, 0x1000, 0x0, 0x4000, 0xc000, 0x0, 0x0,
-	0x0, 0x0, 0x100000, 0x200000, 0x400000, 0x0, 0x0, 0x0, 0x0, 0x8100000, 0x0, 0x20200000, 0x0, 0x80400000, 0x0, 0x0,
-	0x408100000, 0x0, 0x0, 0x2020200000, 0x0, 0x0, 0x0, 0x20408100000, 0x0, 0x0, 0x0, 0x202020200000, 0x0, 0x0,
-	0x1020408100000, 0x0, 0x0, 0x0, 0x0, 0x20202020200000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2020202020200000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x40, 0x80, 0x3f00, 0x3e00, 0x3c00, 0x3800, 0x3000, 0x2000, 0x0, 0x8000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x200000, 0x400000, 0x800000, 0x0, 0x0, 0x0, 0x0, 0x10200000, 0x0, 0x40400000, 0x0, 0x0, 0x0,
-	0x0, 0x810200000, 0x0, 0x0, 0x4040400000, 0x0, 0x0, 0x0, 0x40810200000, 0x0, 0x0, 0x0, 0x404040400000, 0x0, 0x0,
-	0x2040810200000, 0x0, 0x0, 0x0, 0x0, 0x40404040400000, 0x0, 0x102040810200000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x4040404040400000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x80, 0x7f00, 0x7e00, 0x7c00, 0x7800, 0x7000, 0x6000,
-	0x4000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x400000, 0x800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20400000, 0x0, 0x80800000,
-	0x0, 0x0, 0x0, 0x0, 0x1020400000, 0x0, 0x0, 0x8080800000, 0x0, 0x0, 0x0, 0x81020400000, 0x0, 0x0, 0x0,
-	0x808080800000, 0x0, 0x0, 0x4081020400000, 0x0, 0x0, 0x0, 0x0, 0x80808080800000, 0x0, 0x204081020400000, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x8080808080800000, 0x101, 0x0, 0x204, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x200, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x20000, 0x60000, 0xe0000, 0x1e0000, 0x3e0000, 0x7e0000, 0xfe0000, 0x1000000, 0x2000000, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x101000000, 0x0, 0x402000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10101000000, 0x0, 0x0, 0x80402000000,
-	0x0, 0x0, 0x0, 0x0, 0x1010101000000, 0x0, 0x0, 0x0, 0x10080402000000, 0x0, 0x0, 0x0, 0x101010101000000, 0x0, 0x0,
-	0x0, 0x0, 0x2010080402000000, 0x0, 0x0, 0x0, 0x202, 0x0, 0x408, 0x0, 0x0, 0x0, 0x0, 0x100, 0x200, 0x400, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x10000, 0x0, 0x40000, 0xc0000, 0x1c0000, 0x3c0000, 0x7c0000, 0xfc0000, 0x1000000, 0x2000000,
-	0x4000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202000000, 0x0, 0x804000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20202000000, 0x0,
-	0x0, 0x100804000000, 0x0, 0x0, 0x0, 0x0, 0x2020202000000, 0x0, 0x0, 0x0, 0x20100804000000, 0x0, 0x0, 0x0,
-	0x202020202000000, 0x0, 0x0, 0x0, 0x0, 0x4020100804000000, 0x0, 0x201, 0x0, 0x404, 0x0, 0x810, 0x0, 0x0, 0x0, 0x0,
-	0x200, 0x400, 0x800, 0x0, 0x0, 0x0, 0x0, 0x30000, 0x20000, 0x0, 0x80000, 0x180000, 0x380000, 0x780000, 0xf80000,
-	0x0, 0x2000000, 0x4000000, 0x8000000, 0x0, 0x0, 0x0, 0x0, 0x102000000, 0x0, 0x404000000, 0x0, 0x1008000000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x40404000000, 0x0, 0x0, 0x201008000000, 0x0, 0x0, 0x0, 0x0, 0x4040404000000, 0x0, 0x0, 0x0,
-	0x40201008000000, 0x0, 0x0, 0x0, 0x404040404000000, 0x0, 0x0, 0x0, 0x0, 0x8040201008000000, 0x0, 0x402, 0x0, 0x808,
-	0x0, 0x1020, 0x0, 0x0, 0x0, 0x0, 0x400, 0x800, 0x1000, 0x0, 0x0, 0x0, 0x70000, 0x60000, 0x40000, 0x0, 0x100000,
-	0x300000, 0x700000, 0xf00000, 0x0, 0x0, 0x4000000, 0x8000000, 0x10000000, 0x0, 0x0, 0x0, 0x0, 0x204000000, 0x0,
-	0x808000000, 0x0, 0x2010000000, 0x0, 0x0, 0x10204000000, 0x0, 0x0, 0x80808000000, 0x0, 0x0, 0x402010000000, 0x0,
-	0x0, 0x0, 0x0, 0x8080808000000, 0x0, 0x0, 0x0, 0x80402010000000, 0x0, 0x0, 0x0, 0x808080808000000, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x804, 0x0, 0x1010, 0x0, 0x2040, 0x0, 0x0, 0x0, 0x0, 0x800, 0x1000, 0x2000, 0x0, 0x0, 0xf0000,
-	0xe0000, 0xc0000, 0x80000, 0x0, 0x200000, 0x600000, 0xe00000, 0x0, 0x0, 0x0, 0x8000000, 0x10000000, 0x20000000, 0x0,
-	0x0, 0x0, 0x0, 0x408000000, 0x0, 0x1010000000, 0x0, 0x4020000000, 0x0, 0x0, 0x20408000000, 0x0, 0x0, 0x101010000000,
-	0x0, 0x0, 0x804020000000, 0x1020408000000, 0x0, 0x0, 0x0, 0x10101010000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x1010101010000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1008, 0x0, 0x2020, 0x0, 0x4080, 0x0, 0x0, 0x0, 0x0, 0x1000,
-	0x2000, 0x4000, 0x0, 0x1f0000, 0x1e0000, 0x1c0000, 0x180000, 0x100000, 0x0, 0x400000, 0xc00000, 0x0, 0x0, 0x0, 0x0,
-	0x10000000, 0x20000000, 0x40000000, 0x0, 0x0, 0x0, 0x0, 0x810000000, 0x0, 0x2020000000, 0x0, 0x8040000000, 0x0, 0x0,
-	0x40810000000, 0x0, 0x0, 0x202020000000, 0x0, 0x0, 0x0, 0x2040810000000, 0x0, 0x0, 0x0, 0x20202020000000, 0x0, 0x0,
-	0x102040810000000, 0x0, 0x0, 0x0, 0x0, 0x2020202020000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2010, 0x0, 0x4040, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x2000, 0x4000, 0x8000, 0x3f0000, 0x3e0000, 0x3c0000, 0x380000, 0x300000, 0x200000, 0x0,
-	0x800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20000000, 0x40000000, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x1020000000, 0x0,
-	0x4040000000, 0x0, 0x0, 0x0, 0x0, 0x81020000000, 0x0, 0x0, 0x404040000000, 0x0, 0x0, 0x0, 0x4081020000000, 0x0, 0x0,
-	0x0, 0x40404040000000, 0x0, 0x0, 0x204081020000000, 0x0, 0x0, 0x0, 0x0, 0x4040404040000000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x4020, 0x0, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x8000, 0x7f0000, 0x7e0000, 0x7c0000, 0x780000,
-	0x700000, 0x600000, 0x400000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40000000, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x2040000000, 0x0, 0x8080000000, 0x0, 0x0, 0x0, 0x0, 0x102040000000, 0x0, 0x0, 0x808080000000, 0x0, 0x0, 0x0,
-	0x8102040000000, 0x0, 0x0, 0x0, 0x80808080000000, 0x0, 0x0, 0x408102040000000, 0x0, 0x0, 0x0, 0x0,
-	0x8080808080000000, 0x10101, 0x0, 0x0, 0x20408, 0x0, 0x0, 0x0, 0x0, 0x10100, 0x0, 0x20400, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x10000, 0x20000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000000, 0x6000000, 0xe000000, 0x1e000000, 0x3e000000,
-	0x7e000000, 0xfe000000, 0x100000000, 0x200000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10100000000, 0x0, 0x40200000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x1010100000000, 0x0, 0x0, 0x8040200000000, 0x0, 0x0, 0x0, 0x0, 0x101010100000000, 0x0,
-	0x0, 0x0, 0x1008040200000000, 0x0, 0x0, 0x0, 0x0, 0x20202, 0x0, 0x0, 0x40810, 0x0, 0x0, 0x0, 0x0, 0x20200, 0x0,
-	0x40800, 0x0, 0x0, 0x0, 0x0, 0x10000, 0x20000, 0x40000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x0, 0x4000000,
-	0xc000000, 0x1c000000, 0x3c000000, 0x7c000000, 0xfc000000, 0x100000000, 0x200000000, 0x400000000, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x20200000000, 0x0, 0x80400000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2020200000000, 0x0, 0x0,
-	0x10080400000000, 0x0, 0x0, 0x0, 0x0, 0x202020200000000, 0x0, 0x0, 0x0, 0x2010080400000000, 0x0, 0x0, 0x0, 0x0,
-	0x40404, 0x0, 0x0, 0x81020, 0x0, 0x0, 0x20100, 0x0, 0x40400, 0x0, 0x81000, 0x0, 0x0, 0x0, 0x0, 0x20000, 0x40000,
-	0x80000, 0x0, 0x0, 0x0, 0x0, 0x3000000, 0x2000000, 0x0, 0x8000000, 0x18000000, 0x38000000, 0x78000000, 0xf8000000,
-	0x0, 0x200000000, 0x400000000, 0x800000000, 0x0, 0x0, 0x0, 0x0, 0x10200000000, 0x0, 0x40400000000, 0x0,
-	0x100800000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4040400000000, 0x0, 0x0, 0x20100800000000, 0x0, 0x0, 0x0, 0x0,
-	0x404040400000000, 0x0, 0x0, 0x0, 0x4020100800000000, 0x0, 0x40201, 0x0, 0x0, 0x80808, 0x0, 0x0, 0x102040, 0x0, 0x0,
-	0x40200, 0x0, 0x80800, 0x0, 0x102000, 0x0, 0x0, 0x0, 0x0, 0x40000, 0x80000, 0x100000, 0x0, 0x0, 0x0, 0x7000000,
-	0x6000000, 0x4000000, 0x0, 0x10000000, 0x30000000, 0x70000000, 0xf0000000, 0x0, 0x0, 0x400000000, 0x800000000,
-	0x1000000000, 0x0, 0x0, 0x0, 0x0, 0x20400000000, 0x0, 0x80800000000, 0x0, 0x201000000000, 0x0, 0x0, 0x1020400000000,
-	0x0, 0x0, 0x8080800000000, 0x0, 0x0, 0x40201000000000, 0x0, 0x0, 0x0, 0x0, 0x808080800000000, 0x0, 0x0, 0x0,
-	0x8040201000000000, 0x0, 0x80402, 0x0, 0x0, 0x101010, 0x0, 0x0, 0x204080, 0x0, 0x0, 0x80400, 0x0, 0x101000, 0x0,
-	0x204000, 0x0, 0x0, 0x0, 0x0, 0x80000, 0x100000, 0x200000, 0x0, 0x0, 0xf000000, 0xe000000, 0xc000000, 0x8000000,
-	0x0, 0x20000000, 0x60000000, 0xe0000000, 0x0, 0x0, 0x0, 0x800000000, 0x1000000000, 0x2000000000, 0x0, 0x0, 0x0, 0x0,
-	0x40800000000, 0x0, 0x101000000000, 0x0, 0x402000000000, 0x0, 0x0, 0x2040800000000, 0x0, 0x0, 0x10101000000000, 0x0,
-	0x0, 0x80402000000000, 0x102040800000000, 0x0, 0x0, 0x0, 0x1010101000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100804, 0x0,
-	0x0, 0x202020, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100800, 0x0, 0x202000, 0x0, 0x408000, 0x0, 0x0, 0x0, 0x0, 0x100000,
-	0x200000, 0x400000, 0x0, 0x1f000000, 0x1e000000, 0x1c000000, 0x18000000, 0x10000000, 0x0, 0x40000000, 0xc0000000,
-	0x0, 0x0, 0x0, 0x0, 0x1000000000, 0x2000000000, 0x4000000000, 0x0, 0x0, 0x0, 0x0, 0x81000000000, 0x0,
-	0x202000000000, 0x0, 0x804000000000, 0x0, 0x0, 0x4081000000000, 0x0, 0x0, 0x20202000000000, 0x0, 0x0, 0x0,
-	0x204081000000000, 0x0, 0x0, 0x0, 0x2020202000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x201008, 0x0, 0x0, 0x404040, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x201000, 0x0, 0x404000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x200000, 0x400000, 0x800000, 0x3f000000,
-	0x3e000000, 0x3c000000, 0x38000000, 0x30000000, 0x20000000, 0x0, 0x80000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000000000,
-	0x4000000000, 0x8000000000, 0x0, 0x0, 0x0, 0x0, 0x102000000000, 0x0, 0x404000000000, 0x0, 0x0, 0x0, 0x0,
-	0x8102000000000, 0x0, 0x0, 0x40404000000000, 0x0, 0x0, 0x0, 0x408102000000000, 0x0, 0x0, 0x0, 0x4040404000000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x402010, 0x0, 0x0, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x402000, 0x0, 0x808000, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x400000, 0x800000, 0x7f000000, 0x7e000000, 0x7c000000, 0x78000000, 0x70000000, 0x60000000,
-	0x40000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000000000, 0x8000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x204000000000,
-	0x0, 0x808000000000, 0x0, 0x0, 0x0, 0x0, 0x10204000000000, 0x0, 0x0, 0x80808000000000, 0x0, 0x0, 0x0,
-	0x810204000000000, 0x0, 0x0, 0x0, 0x8080808000000000, 0x1010101, 0x0, 0x0, 0x0, 0x2040810, 0x0, 0x0, 0x0, 0x1010100,
-	0x0, 0x0, 0x2040800, 0x0, 0x0, 0x0, 0x0, 0x1010000, 0x0, 0x2040000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x2000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x200000000, 0x600000000, 0xe00000000, 0x1e00000000, 0x3e00000000, 0x7e00000000,
-	0xfe00000000, 0x10000000000, 0x20000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010000000000, 0x0, 0x4020000000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x101010000000000, 0x0, 0x0, 0x804020000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2020202, 0x0,
-	0x0, 0x0, 0x4081020, 0x0, 0x0, 0x0, 0x2020200, 0x0, 0x0, 0x4081000, 0x0, 0x0, 0x0, 0x0, 0x2020000, 0x0, 0x4080000,
-	0x0, 0x0, 0x0, 0x0, 0x1000000, 0x2000000, 0x4000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100000000, 0x0, 0x400000000,
-	0xc00000000, 0x1c00000000, 0x3c00000000, 0x7c00000000, 0xfc00000000, 0x10000000000, 0x20000000000, 0x40000000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2020000000000, 0x0, 0x8040000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202020000000000,
-	0x0, 0x0, 0x1008040000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4040404, 0x0, 0x0, 0x0, 0x8102040, 0x0, 0x0, 0x0,
-	0x4040400, 0x0, 0x0, 0x8102000, 0x0, 0x0, 0x2010000, 0x0, 0x4040000, 0x0, 0x8100000, 0x0, 0x0, 0x0, 0x0, 0x2000000,
-	0x4000000, 0x8000000, 0x0, 0x0, 0x0, 0x0, 0x300000000, 0x200000000, 0x0, 0x800000000, 0x1800000000, 0x3800000000,
-	0x7800000000, 0xf800000000, 0x0, 0x20000000000, 0x40000000000, 0x80000000000, 0x0, 0x0, 0x0, 0x0, 0x1020000000000,
-	0x0, 0x4040000000000, 0x0, 0x10080000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x404040000000000, 0x0, 0x0,
-	0x2010080000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8080808, 0x0, 0x0, 0x0, 0x10204080, 0x4020100, 0x0, 0x0, 0x8080800,
-	0x0, 0x0, 0x10204000, 0x0, 0x0, 0x4020000, 0x0, 0x8080000, 0x0, 0x10200000, 0x0, 0x0, 0x0, 0x0, 0x4000000,
-	0x8000000, 0x10000000, 0x0, 0x0, 0x0, 0x700000000, 0x600000000, 0x400000000, 0x0, 0x1000000000, 0x3000000000,
-	0x7000000000, 0xf000000000, 0x0, 0x0, 0x40000000000, 0x80000000000, 0x100000000000, 0x0, 0x0, 0x0, 0x0,
-	0x2040000000000, 0x0, 0x8080000000000, 0x0, 0x20100000000000, 0x0, 0x0, 0x102040000000000, 0x0, 0x0,
-	0x808080000000000, 0x0, 0x0, 0x4020100000000000, 0x0, 0x8040201, 0x0, 0x0, 0x0, 0x10101010, 0x0, 0x0, 0x0, 0x0,
-	0x8040200, 0x0, 0x0, 0x10101000, 0x0, 0x0, 0x20408000, 0x0, 0x0, 0x8040000, 0x0, 0x10100000, 0x0, 0x20400000, 0x0,
-	0x0, 0x0, 0x0, 0x8000000, 0x10000000, 0x20000000, 0x0, 0x0, 0xf00000000, 0xe00000000, 0xc00000000, 0x800000000, 0x0,
-	0x2000000000, 0x6000000000, 0xe000000000, 0x0, 0x0, 0x0, 0x80000000000, 0x100000000000, 0x200000000000, 0x0, 0x0,
-	0x0, 0x0, 0x4080000000000, 0x0, 0x10100000000000, 0x0, 0x40200000000000, 0x0, 0x0, 0x204080000000000, 0x0, 0x0,
-	0x1010100000000000, 0x0, 0x0, 0x8040200000000000, 0x0, 0x10080402, 0x0, 0x0, 0x0, 0x20202020, 0x0, 0x0, 0x0, 0x0,
-	0x10080400, 0x0, 0x0, 0x20202000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10080000, 0x0, 0x20200000, 0x0, 0x40800000, 0x0, 0x0,
-	0x0, 0x0, 0x10000000, 0x20000000, 0x40000000, 0x0, 0x1f00000000, 0x1e00000000, 0x1c00000000, 0x1800000000,
-	0x1000000000, 0x0, 0x4000000000, 0xc000000000, 0x0, 0x0, 0x0, 0x0, 0x100000000000, 0x200000000000, 0x400000000000,
-	0x0, 0x0, 0x0, 0x0, 0x8100000000000, 0x0, 0x20200000000000, 0x0, 0x80400000000000, 0x0, 0x0, 0x408100000000000, 0x0,
-	0x0, 0x2020200000000000, 0x0, 0x0, 0x0, 0x0, 0x20100804, 0x0, 0x0, 0x0, 0x40404040, 0x0, 0x0, 0x0, 0x0, 0x20100800,
-	0x0, 0x0, 0x40404000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20100000, 0x0, 0x40400000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x20000000, 0x40000000, 0x80000000, 0x3f00000000, 0x3e00000000, 0x3c00000000, 0x3800000000, 0x3000000000,
-	0x2000000000, 0x0, 0x8000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x200000000000, 0x400000000000, 0x800000000000, 0x0, 0x0,
-	0x0, 0x0, 0x10200000000000, 0x0, 0x40400000000000, 0x0, 0x0, 0x0, 0x0, 0x810200000000000, 0x0, 0x0,
-	0x4040400000000000, 0x0, 0x0, 0x0, 0x0, 0x40201008, 0x0, 0x0, 0x0, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x40201000, 0x0,
-	0x0, 0x80808000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40200000, 0x0, 0x80800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40000000,
-	0x80000000, 0x7f00000000, 0x7e00000000, 0x7c00000000, 0x7800000000, 0x7000000000, 0x6000000000, 0x4000000000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x400000000000, 0x800000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20400000000000, 0x0,
-	0x80800000000000, 0x0, 0x0, 0x0, 0x0, 0x1020400000000000, 0x0, 0x0, 0x8080800000000000, 0x101010101, 0x0, 0x0, 0x0,
-	0x0, 0x204081020, 0x0, 0x0, 0x101010100, 0x0, 0x0, 0x0, 0x204081000, 0x0, 0x0, 0x0, 0x101010000, 0x0, 0x0,
-	0x204080000, 0x0, 0x0, 0x0, 0x0, 0x101000000, 0x0, 0x204000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100000000, 0x200000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20000000000, 0x60000000000, 0xe0000000000, 0x1e0000000000, 0x3e0000000000,
-	0x7e0000000000, 0xfe0000000000, 0x1000000000000, 0x2000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101000000000000,
-	0x0, 0x402000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202020202, 0x0, 0x0, 0x0, 0x0, 0x408102040, 0x0, 0x0,
-	0x202020200, 0x0, 0x0, 0x0, 0x408102000, 0x0, 0x0, 0x0, 0x202020000, 0x0, 0x0, 0x408100000, 0x0, 0x0, 0x0, 0x0,
-	0x202000000, 0x0, 0x408000000, 0x0, 0x0, 0x0, 0x0, 0x100000000, 0x200000000, 0x400000000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x10000000000, 0x0, 0x40000000000, 0xc0000000000, 0x1c0000000000, 0x3c0000000000, 0x7c0000000000, 0xfc0000000000,
-	0x1000000000000, 0x2000000000000, 0x4000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202000000000000, 0x0,
-	0x804000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x404040404, 0x0, 0x0, 0x0, 0x0, 0x810204080, 0x0, 0x0,
-	0x404040400, 0x0, 0x0, 0x0, 0x810204000, 0x0, 0x0, 0x0, 0x404040000, 0x0, 0x0, 0x810200000, 0x0, 0x0, 0x201000000,
-	0x0, 0x404000000, 0x0, 0x810000000, 0x0, 0x0, 0x0, 0x0, 0x200000000, 0x400000000, 0x800000000, 0x0, 0x0, 0x0, 0x0,
-	0x30000000000, 0x20000000000, 0x0, 0x80000000000, 0x180000000000, 0x380000000000, 0x780000000000, 0xf80000000000,
-	0x0, 0x2000000000000, 0x4000000000000, 0x8000000000000, 0x0, 0x0, 0x0, 0x0, 0x102000000000000, 0x0,
-	0x404000000000000, 0x0, 0x1008000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x808080808, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x808080800, 0x0, 0x0, 0x0, 0x1020408000, 0x402010000, 0x0, 0x0, 0x808080000, 0x0, 0x0, 0x1020400000, 0x0, 0x0,
-	0x402000000, 0x0, 0x808000000, 0x0, 0x1020000000, 0x0, 0x0, 0x0, 0x0, 0x400000000, 0x800000000, 0x1000000000, 0x0,
-	0x0, 0x0, 0x70000000000, 0x60000000000, 0x40000000000, 0x0, 0x100000000000, 0x300000000000, 0x700000000000,
-	0xf00000000000, 0x0, 0x0, 0x4000000000000, 0x8000000000000, 0x10000000000000, 0x0, 0x0, 0x0, 0x0, 0x204000000000000,
-	0x0, 0x808000000000000, 0x0, 0x2010000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010101010, 0x0, 0x0, 0x0,
-	0x804020100, 0x0, 0x0, 0x0, 0x1010101000, 0x0, 0x0, 0x0, 0x0, 0x804020000, 0x0, 0x0, 0x1010100000, 0x0, 0x0,
-	0x2040800000, 0x0, 0x0, 0x804000000, 0x0, 0x1010000000, 0x0, 0x2040000000, 0x0, 0x0, 0x0, 0x0, 0x800000000,
-	0x1000000000, 0x2000000000, 0x0, 0x0, 0xf0000000000, 0xe0000000000, 0xc0000000000, 0x80000000000, 0x0,
-	0x200000000000, 0x600000000000, 0xe00000000000, 0x0, 0x0, 0x0, 0x8000000000000, 0x10000000000000, 0x20000000000000,
-	0x0, 0x0, 0x0, 0x0, 0x408000000000000, 0x0, 0x1010000000000000, 0x0, 0x4020000000000000, 0x0, 0x1008040201, 0x0,
-	0x0, 0x0, 0x0, 0x2020202020, 0x0, 0x0, 0x0, 0x1008040200, 0x0, 0x0, 0x0, 0x2020202000, 0x0, 0x0, 0x0, 0x0,
-	0x1008040000, 0x0, 0x0, 0x2020200000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1008000000, 0x0, 0x2020000000, 0x0, 0x4080000000,
-	0x0, 0x0, 0x0, 0x0, 0x1000000000, 0x2000000000, 0x4000000000, 0x0, 0x1f0000000000, 0x1e0000000000, 0x1c0000000000,
-	0x180000000000, 0x100000000000, 0x0, 0x400000000000, 0xc00000000000, 0x0, 0x0, 0x0, 0x0, 0x10000000000000,
-	0x20000000000000, 0x40000000000000, 0x0, 0x0, 0x0, 0x0, 0x810000000000000, 0x0, 0x2020000000000000, 0x0,
-	0x8040000000000000, 0x0, 0x2010080402, 0x0, 0x0, 0x0, 0x0, 0x4040404040, 0x0, 0x0, 0x0, 0x2010080400, 0x0, 0x0, 0x0,
-	0x4040404000, 0x0, 0x0, 0x0, 0x0, 0x2010080000, 0x0, 0x0, 0x4040400000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2010000000, 0x0,
-	0x4040000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000000000, 0x4000000000, 0x8000000000, 0x3f0000000000,
-	0x3e0000000000, 0x3c0000000000, 0x380000000000, 0x300000000000, 0x200000000000, 0x0, 0x800000000000, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x20000000000000, 0x40000000000000, 0x80000000000000, 0x0, 0x0, 0x0, 0x0, 0x1020000000000000, 0x0,
-	0x4040000000000000, 0x0, 0x0, 0x0, 0x4020100804, 0x0, 0x0, 0x0, 0x0, 0x8080808080, 0x0, 0x0, 0x0, 0x4020100800, 0x0,
-	0x0, 0x0, 0x8080808000, 0x0, 0x0, 0x0, 0x0, 0x4020100000, 0x0, 0x0, 0x8080800000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x4020000000, 0x0, 0x8080000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000000000, 0x8000000000, 0x7f0000000000,
-	0x7e0000000000, 0x7c0000000000, 0x780000000000, 0x700000000000, 0x600000000000, 0x400000000000, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x40000000000000, 0x80000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2040000000000000, 0x0,
-	0x8080000000000000, 0x10101010101, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20408102040, 0x0, 0x10101010100, 0x0, 0x0, 0x0, 0x0,
-	0x20408102000, 0x0, 0x0, 0x10101010000, 0x0, 0x0, 0x0, 0x20408100000, 0x0, 0x0, 0x0, 0x10101000000, 0x0, 0x0,
-	0x20408000000, 0x0, 0x0, 0x0, 0x0, 0x10100000000, 0x0, 0x20400000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10000000000,
-	0x20000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000000000000, 0x6000000000000, 0xe000000000000,
-	0x1e000000000000, 0x3e000000000000, 0x7e000000000000, 0xfe000000000000, 0x100000000000000, 0x200000000000000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20202020202, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40810204080, 0x0, 0x20202020200, 0x0, 0x0,
-	0x0, 0x0, 0x40810204000, 0x0, 0x0, 0x20202020000, 0x0, 0x0, 0x0, 0x40810200000, 0x0, 0x0, 0x0, 0x20202000000, 0x0,
-	0x0, 0x40810000000, 0x0, 0x0, 0x0, 0x0, 0x20200000000, 0x0, 0x40800000000, 0x0, 0x0, 0x0, 0x0, 0x10000000000,
-	0x20000000000, 0x40000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000000000, 0x0, 0x4000000000000, 0xc000000000000,
-	0x1c000000000000, 0x3c000000000000, 0x7c000000000000, 0xfc000000000000, 0x100000000000000, 0x200000000000000,
-	0x400000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40404040404, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x40404040400, 0x0, 0x0, 0x0, 0x0, 0x81020408000, 0x0, 0x0, 0x40404040000, 0x0, 0x0, 0x0, 0x81020400000, 0x0, 0x0,
-	0x0, 0x40404000000, 0x0, 0x0, 0x81020000000, 0x0, 0x0, 0x20100000000, 0x0, 0x40400000000, 0x0, 0x81000000000, 0x0,
-	0x0, 0x0, 0x0, 0x20000000000, 0x40000000000, 0x80000000000, 0x0, 0x0, 0x0, 0x0, 0x3000000000000, 0x2000000000000,
-	0x0, 0x8000000000000, 0x18000000000000, 0x38000000000000, 0x78000000000000, 0xf8000000000000, 0x0,
-	0x200000000000000, 0x400000000000000, 0x800000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80808080808, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x80808080800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80808080000, 0x0, 0x0, 0x0,
-	0x102040800000, 0x40201000000, 0x0, 0x0, 0x80808000000, 0x0, 0x0, 0x102040000000, 0x0, 0x0, 0x40200000000, 0x0,
-	0x80800000000, 0x0, 0x102000000000, 0x0, 0x0, 0x0, 0x0, 0x40000000000, 0x80000000000, 0x100000000000, 0x0, 0x0, 0x0,
-	0x7000000000000, 0x6000000000000, 0x4000000000000, 0x0, 0x10000000000000, 0x30000000000000, 0x70000000000000,
-	0xf0000000000000, 0x0, 0x0, 0x400000000000000, 0x800000000000000, 0x1000000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x101010101010, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101010101000, 0x0, 0x0, 0x0, 0x80402010000, 0x0, 0x0, 0x0,
-	0x101010100000, 0x0, 0x0, 0x0, 0x0, 0x80402000000, 0x0, 0x0, 0x101010000000, 0x0, 0x0, 0x204080000000, 0x0, 0x0,
-	0x80400000000, 0x0, 0x101000000000, 0x0, 0x204000000000, 0x0, 0x0, 0x0, 0x0, 0x80000000000, 0x100000000000,
-	0x200000000000, 0x0, 0x0, 0xf000000000000, 0xe000000000000, 0xc000000000000, 0x8000000000000, 0x0, 0x20000000000000,
-	0x60000000000000, 0xe0000000000000, 0x0, 0x0, 0x0, 0x800000000000000, 0x1000000000000000, 0x2000000000000000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202020202020, 0x0, 0x0, 0x100804020100, 0x0, 0x0, 0x0, 0x0, 0x202020202000, 0x0,
-	0x0, 0x0, 0x100804020000, 0x0, 0x0, 0x0, 0x202020200000, 0x0, 0x0, 0x0, 0x0, 0x100804000000, 0x0, 0x0,
-	0x202020000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100800000000, 0x0, 0x202000000000, 0x0, 0x408000000000, 0x0, 0x0, 0x0,
-	0x0, 0x100000000000, 0x200000000000, 0x400000000000, 0x0, 0x1f000000000000, 0x1e000000000000, 0x1c000000000000,
-	0x18000000000000, 0x10000000000000, 0x0, 0x40000000000000, 0xc0000000000000, 0x0, 0x0, 0x0, 0x0, 0x1000000000000000,
-	0x2000000000000000, 0x4000000000000000, 0x0, 0x201008040201, 0x0, 0x0, 0x0, 0x0, 0x0, 0x404040404040, 0x0, 0x0,
-	0x201008040200, 0x0, 0x0, 0x0, 0x0, 0x404040404000, 0x0, 0x0, 0x0, 0x201008040000, 0x0, 0x0, 0x0, 0x404040400000,
-	0x0, 0x0, 0x0, 0x0, 0x201008000000, 0x0, 0x0, 0x404040000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x201000000000, 0x0,
-	0x404000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x200000000000, 0x400000000000, 0x800000000000, 0x3f000000000000,
-	0x3e000000000000, 0x3c000000000000, 0x38000000000000, 0x30000000000000, 0x20000000000000, 0x0, 0x80000000000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x2000000000000000, 0x4000000000000000, 0x8000000000000000, 0x0, 0x402010080402, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x808080808080, 0x0, 0x0, 0x402010080400, 0x0, 0x0, 0x0, 0x0, 0x808080808000, 0x0, 0x0, 0x0,
-	0x402010080000, 0x0, 0x0, 0x0, 0x808080800000, 0x0, 0x0, 0x0, 0x0, 0x402010000000, 0x0, 0x0, 0x808080000000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x402000000000, 0x0, 0x808000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x400000000000,
-	0x800000000000, 0x7f000000000000, 0x7e000000000000, 0x7c000000000000, 0x78000000000000, 0x70000000000000,
-	0x60000000000000, 0x40000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000000000000000, 0x8000000000000000,
-	0x1010101010101, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2040810204080, 0x1010101010100, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x2040810204000, 0x0, 0x1010101010000, 0x0, 0x0, 0x0, 0x0, 0x2040810200000, 0x0, 0x0, 0x1010101000000, 0x0, 0x0,
-	0x0, 0x2040810000000, 0x0, 0x0, 0x0, 0x1010100000000, 0x0, 0x0, 0x2040800000000, 0x0, 0x0, 0x0, 0x0,
-	0x1010000000000, 0x0, 0x2040000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000000000, 0x2000000000000, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x200000000000000, 0x600000000000000, 0xe00000000000000, 0x1e00000000000000, 0x3e00000000000000,
-	0x7e00000000000000, 0xfe00000000000000, 0x0, 0x2020202020202, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2020202020200,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x4081020408000, 0x0, 0x2020202020000, 0x0, 0x0, 0x0, 0x0, 0x4081020400000, 0x0, 0x0,
-	0x2020202000000, 0x0, 0x0, 0x0, 0x4081020000000, 0x0, 0x0, 0x0, 0x2020200000000, 0x0, 0x0, 0x4081000000000, 0x0,
-	0x0, 0x0, 0x0, 0x2020000000000, 0x0, 0x4080000000000, 0x0, 0x0, 0x0, 0x0, 0x1000000000000, 0x2000000000000,
-	0x4000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100000000000000, 0x0, 0x400000000000000, 0xc00000000000000,
-	0x1c00000000000000, 0x3c00000000000000, 0x7c00000000000000, 0xfc00000000000000, 0x0, 0x0, 0x4040404040404, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x4040404040400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4040404040000, 0x0, 0x0, 0x0, 0x0,
-	0x8102040800000, 0x0, 0x0, 0x4040404000000, 0x0, 0x0, 0x0, 0x8102040000000, 0x0, 0x0, 0x0, 0x4040400000000, 0x0,
-	0x0, 0x8102000000000, 0x0, 0x0, 0x2010000000000, 0x0, 0x4040000000000, 0x0, 0x8100000000000, 0x0, 0x0, 0x0, 0x0,
-	0x2000000000000, 0x4000000000000, 0x8000000000000, 0x0, 0x0, 0x0, 0x0, 0x300000000000000, 0x200000000000000, 0x0,
-	0x800000000000000, 0x1800000000000000, 0x3800000000000000, 0x7800000000000000, 0xf800000000000000, 0x0, 0x0, 0x0,
-	0x8080808080808, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8080808080800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x8080808080000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8080808000000, 0x0, 0x0, 0x0, 0x10204080000000,
-	0x4020100000000, 0x0, 0x0, 0x8080800000000, 0x0, 0x0, 0x10204000000000, 0x0, 0x0, 0x4020000000000, 0x0,
-	0x8080000000000, 0x0, 0x10200000000000, 0x0, 0x0, 0x0, 0x0, 0x4000000000000, 0x8000000000000, 0x10000000000000, 0x0,
-	0x0, 0x0, 0x700000000000000, 0x600000000000000, 0x400000000000000, 0x0, 0x1000000000000000, 0x3000000000000000,
-	0x7000000000000000, 0xf000000000000000, 0x0, 0x0, 0x0, 0x0, 0x10101010101010, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x10101010101000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10101010100000, 0x0, 0x0, 0x0, 0x8040201000000, 0x0, 0x0,
-	0x0, 0x10101010000000, 0x0, 0x0, 0x0, 0x0, 0x8040200000000, 0x0, 0x0, 0x10101000000000, 0x0, 0x0, 0x20408000000000,
-	0x0, 0x0, 0x8040000000000, 0x0, 0x10100000000000, 0x0, 0x20400000000000, 0x0, 0x0, 0x0, 0x0, 0x8000000000000,
-	0x10000000000000, 0x20000000000000, 0x0, 0x0, 0xf00000000000000, 0xe00000000000000, 0xc00000000000000,
-	0x800000000000000, 0x0, 0x2000000000000000, 0x6000000000000000, 0xe000000000000000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x20202020202020, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20202020202000, 0x0, 0x0, 0x10080402010000, 0x0, 0x0, 0x0,
-	0x0, 0x20202020200000, 0x0, 0x0, 0x0, 0x10080402000000, 0x0, 0x0, 0x0, 0x20202020000000, 0x0, 0x0, 0x0, 0x0,
-	0x10080400000000, 0x0, 0x0, 0x20202000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10080000000000, 0x0, 0x20200000000000, 0x0,
-	0x40800000000000, 0x0, 0x0, 0x0, 0x0, 0x10000000000000, 0x20000000000000, 0x40000000000000, 0x0, 0x1f00000000000000,
-	0x1e00000000000000, 0x1c00000000000000, 0x1800000000000000, 0x1000000000000000, 0x0, 0x4000000000000000,
-	0xc000000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40404040404040, 0x0, 0x20100804020100, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x40404040404000, 0x0, 0x0, 0x20100804020000, 0x0, 0x0, 0x0, 0x0, 0x40404040400000, 0x0, 0x0, 0x0, 0x20100804000000,
-	0x0, 0x0, 0x0, 0x40404040000000, 0x0, 0x0, 0x0, 0x0, 0x20100800000000, 0x0, 0x0, 0x40404000000000, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x20100000000000, 0x0, 0x40400000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20000000000000, 0x40000000000000,
-	0x80000000000000, 0x3f00000000000000, 0x3e00000000000000, 0x3c00000000000000, 0x3800000000000000,
-	0x3000000000000000, 0x2000000000000000, 0x0, 0x8000000000000000, 0x40201008040201, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x80808080808080, 0x0, 0x40201008040200, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80808080808000, 0x0, 0x0, 0x40201008040000, 0x0,
-	0x0, 0x0, 0x0, 0x80808080800000, 0x0, 0x0, 0x0, 0x40201008000000, 0x0, 0x0, 0x0, 0x80808080000000, 0x0, 0x0, 0x0,
-	0x0, 0x40201000000000, 0x0, 0x0, 0x80808000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40200000000000, 0x0, 0x80800000000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40000000000000, 0x80000000000000, 0x7f00000000000000, 0x7e00000000000000,
-	0x7c00000000000000, 0x7800000000000000, 0x7000000000000000, 0x6000000000000000, 0x4000000000000000, 0x0,
+#include <array>
+#include <bit>
+#include <cstdint>
+
+struct RayTables {
+	std::array<uint64_t, 4096> m_Rays{ };
+	std::array<uint64_t, 4096> m_XRays{ };
 };
 
+// For every aligned (from, to) pair: the ray walks from `from` (exclusive) to `to` (inclusive), the x-ray keeps going
+// to the board edge. Pairs that share no line or diagonal stay empty.
+static constexpr RayTables GenerateRayTables() {
+	constexpr int8_t directions[8][2]{ { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 }, { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
 
-static constexpr uint64_t XRAYS[4096]{
-	0x0, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x101010101010100, 0x8040201008040200, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x101010101010100, 0x0, 0x8040201008040200, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101010101010100, 0x0, 0x0, 0x8040201008040200, 0x0,
-	0x0, 0x0, 0x0, 0x101010101010100, 0x0, 0x0, 0x0, 0x8040201008040200, 0x0, 0x0, 0x0, 0x101010101010100, 0x0, 0x0, 0x0, 0x0,
-	0x8040201008040200, 0x0, 0x0, 0x101010101010100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8040201008040200, 0x0, 0x101010101010100, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x8040201008040200, 0x1, 0x0, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x100, 0x202020202020200,
-	0x80402010080400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202020202020200, 0x0, 0x80402010080400, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x202020202020200, 0x0, 0x0, 0x80402010080400, 0x0, 0x0, 0x0, 0x0, 0x202020202020200, 0x0, 0x0, 0x0, 0x80402010080400, 0x0,
-	0x0, 0x0, 0x202020202020200, 0x0, 0x0, 0x0, 0x0, 0x80402010080400, 0x0, 0x0, 0x202020202020200, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x80402010080400, 0x0, 0x202020202020200, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x0,
-	0x10200, 0x404040404040400, 0x804020100800, 0x0, 0x0, 0x0, 0x0, 0x10200, 0x0, 0x404040404040400, 0x0, 0x804020100800, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x404040404040400, 0x0, 0x0, 0x804020100800, 0x0, 0x0, 0x0, 0x0, 0x404040404040400, 0x0, 0x0, 0x0,
-	0x804020100800, 0x0, 0x0, 0x0, 0x404040404040400, 0x0, 0x0, 0x0, 0x0, 0x804020100800, 0x0, 0x0, 0x404040404040400, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x404040404040400, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x0, 0xf0, 0xf0, 0xf0, 0xf0, 0x0, 0x0,
-	0x1020400, 0x808080808080800, 0x8040201000, 0x0, 0x0, 0x0, 0x0, 0x1020400, 0x0, 0x808080808080800, 0x0, 0x8040201000, 0x0,
-	0x0, 0x1020400, 0x0, 0x0, 0x808080808080800, 0x0, 0x0, 0x8040201000, 0x0, 0x0, 0x0, 0x0, 0x808080808080800, 0x0, 0x0, 0x0,
-	0x8040201000, 0x0, 0x0, 0x0, 0x808080808080800, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x808080808080800, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x808080808080800, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf, 0xf, 0xf, 0x0, 0xe0, 0xe0, 0xe0, 0x0, 0x0, 0x0, 0x102040800,
-	0x1010101010101000, 0x80402000, 0x0, 0x0, 0x0, 0x0, 0x102040800, 0x0, 0x1010101010101000, 0x0, 0x80402000, 0x0, 0x0,
-	0x102040800, 0x0, 0x0, 0x1010101010101000, 0x0, 0x0, 0x80402000, 0x102040800, 0x0, 0x0, 0x0, 0x1010101010101000, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x1010101010101000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010101010101000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x1010101010101000, 0x0, 0x0, 0x0, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0, 0xc0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x10204081000,
-	0x2020202020202000, 0x804000, 0x0, 0x0, 0x0, 0x0, 0x10204081000, 0x0, 0x2020202020202000, 0x0, 0x804000, 0x0, 0x0,
-	0x10204081000, 0x0, 0x0, 0x2020202020202000, 0x0, 0x0, 0x0, 0x10204081000, 0x0, 0x0, 0x0, 0x2020202020202000, 0x0, 0x0,
-	0x10204081000, 0x0, 0x0, 0x0, 0x0, 0x2020202020202000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2020202020202000, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x2020202020202000, 0x0, 0x0, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x1020408102000, 0x4040404040404000, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x1020408102000, 0x0, 0x4040404040404000, 0x0, 0x0, 0x0, 0x0,
-	0x1020408102000, 0x0, 0x0, 0x4040404040404000, 0x0, 0x0, 0x0, 0x1020408102000, 0x0, 0x0, 0x0, 0x4040404040404000, 0x0, 0x0,
-	0x1020408102000, 0x0, 0x0, 0x0, 0x0, 0x4040404040404000, 0x0, 0x1020408102000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4040404040404000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4040404040404000, 0x0, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x102040810204000, 0x8080808080808000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x102040810204000, 0x0, 0x8080808080808000, 0x0,
-	0x0, 0x0, 0x0, 0x102040810204000, 0x0, 0x0, 0x8080808080808000, 0x0, 0x0, 0x0, 0x102040810204000, 0x0, 0x0, 0x0,
-	0x8080808080808000, 0x0, 0x0, 0x102040810204000, 0x0, 0x0, 0x0, 0x0, 0x8080808080808000, 0x0, 0x102040810204000, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x8080808080808000, 0x102040810204000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8080808080808000, 0x1, 0x2, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0xfe00, 0xfe00, 0xfe00, 0xfe00, 0xfe00, 0xfe00, 0xfe00, 0x101010101010000, 0x4020100804020000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x101010101010000, 0x0, 0x4020100804020000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101010101010000, 0x0, 0x0,
-	0x4020100804020000, 0x0, 0x0, 0x0, 0x0, 0x101010101010000, 0x0, 0x0, 0x0, 0x4020100804020000, 0x0, 0x0, 0x0,
-	0x101010101010000, 0x0, 0x0, 0x0, 0x0, 0x4020100804020000, 0x0, 0x0, 0x101010101010000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x4020100804020000, 0x0, 0x1, 0x2, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x0, 0xfc00, 0xfc00, 0xfc00, 0xfc00, 0xfc00, 0xfc00,
-	0x10000, 0x202020202020000, 0x8040201008040000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202020202020000, 0x0, 0x8040201008040000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x202020202020000, 0x0, 0x0, 0x8040201008040000, 0x0, 0x0, 0x0, 0x0, 0x202020202020000, 0x0, 0x0, 0x0,
-	0x8040201008040000, 0x0, 0x0, 0x0, 0x202020202020000, 0x0, 0x0, 0x0, 0x0, 0x8040201008040000, 0x0, 0x0, 0x202020202020000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x8040201008040000, 0x0, 0x2, 0x4, 0x8, 0x0, 0x0, 0x0, 0x0, 0x300, 0x300, 0x0, 0xf800, 0xf800,
-	0xf800, 0xf800, 0xf800, 0x0, 0x1020000, 0x404040404040000, 0x80402010080000, 0x0, 0x0, 0x0, 0x0, 0x1020000, 0x0,
-	0x404040404040000, 0x0, 0x80402010080000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x404040404040000, 0x0, 0x0, 0x80402010080000, 0x0, 0x0,
-	0x0, 0x0, 0x404040404040000, 0x0, 0x0, 0x0, 0x80402010080000, 0x0, 0x0, 0x0, 0x404040404040000, 0x0, 0x0, 0x0, 0x0,
-	0x80402010080000, 0x0, 0x0, 0x404040404040000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8, 0x10, 0x0, 0x0, 0x0, 0x700, 0x700,
-	0x700, 0x0, 0xf000, 0xf000, 0xf000, 0xf000, 0x0, 0x0, 0x102040000, 0x808080808080000, 0x804020100000, 0x0, 0x0, 0x0, 0x0,
-	0x102040000, 0x0, 0x808080808080000, 0x0, 0x804020100000, 0x0, 0x0, 0x102040000, 0x0, 0x0, 0x808080808080000, 0x0, 0x0,
-	0x804020100000, 0x0, 0x0, 0x0, 0x0, 0x808080808080000, 0x0, 0x0, 0x0, 0x804020100000, 0x0, 0x0, 0x0, 0x808080808080000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x808080808080000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x10, 0x20, 0x0, 0x0, 0xf00, 0xf00,
-	0xf00, 0xf00, 0x0, 0xe000, 0xe000, 0xe000, 0x0, 0x0, 0x0, 0x10204080000, 0x1010101010100000, 0x8040200000, 0x0, 0x0, 0x0, 0x0,
-	0x10204080000, 0x0, 0x1010101010100000, 0x0, 0x8040200000, 0x0, 0x0, 0x10204080000, 0x0, 0x0, 0x1010101010100000, 0x0, 0x0,
-	0x8040200000, 0x10204080000, 0x0, 0x0, 0x0, 0x1010101010100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010101010100000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010101010100000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x20, 0x40, 0x0, 0x1f00, 0x1f00,
-	0x1f00, 0x1f00, 0x1f00, 0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x1020408100000, 0x2020202020200000, 0x80400000, 0x0, 0x0,
-	0x0, 0x0, 0x1020408100000, 0x0, 0x2020202020200000, 0x0, 0x80400000, 0x0, 0x0, 0x1020408100000, 0x0, 0x0, 0x2020202020200000,
-	0x0, 0x0, 0x0, 0x1020408100000, 0x0, 0x0, 0x0, 0x2020202020200000, 0x0, 0x0, 0x1020408100000, 0x0, 0x0, 0x0, 0x0,
-	0x2020202020200000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2020202020200000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x40,
-	0x80, 0x3f00, 0x3f00, 0x3f00, 0x3f00, 0x3f00, 0x3f00, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x102040810200000,
-	0x4040404040400000, 0x800000, 0x0, 0x0, 0x0, 0x0, 0x102040810200000, 0x0, 0x4040404040400000, 0x0, 0x0, 0x0, 0x0,
-	0x102040810200000, 0x0, 0x0, 0x4040404040400000, 0x0, 0x0, 0x0, 0x102040810200000, 0x0, 0x0, 0x0, 0x4040404040400000, 0x0,
-	0x0, 0x102040810200000, 0x0, 0x0, 0x0, 0x0, 0x4040404040400000, 0x0, 0x102040810200000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x4040404040400000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x80, 0x7f00, 0x7f00, 0x7f00, 0x7f00, 0x7f00, 0x7f00, 0x7f00,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x204081020400000, 0x8080808080800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x204081020400000, 0x0,
-	0x8080808080800000, 0x0, 0x0, 0x0, 0x0, 0x204081020400000, 0x0, 0x0, 0x8080808080800000, 0x0, 0x0, 0x0, 0x204081020400000,
-	0x0, 0x0, 0x0, 0x8080808080800000, 0x0, 0x0, 0x204081020400000, 0x0, 0x0, 0x0, 0x0, 0x8080808080800000, 0x0,
-	0x204081020400000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8080808080800000, 0x101, 0x0, 0x204, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101, 0x204, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe0000, 0xfe0000, 0xfe0000, 0xfe0000, 0xfe0000, 0xfe0000, 0xfe0000, 0x101010101000000,
-	0x2010080402000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101010101000000, 0x0, 0x2010080402000000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x101010101000000, 0x0, 0x0, 0x2010080402000000, 0x0, 0x0, 0x0, 0x0, 0x101010101000000, 0x0, 0x0, 0x0, 0x2010080402000000,
-	0x0, 0x0, 0x0, 0x101010101000000, 0x0, 0x0, 0x0, 0x0, 0x2010080402000000, 0x0, 0x0, 0x0, 0x202, 0x0, 0x408, 0x0, 0x0, 0x0,
-	0x0, 0x100, 0x202, 0x408, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10000, 0x0, 0xfc0000, 0xfc0000, 0xfc0000, 0xfc0000, 0xfc0000, 0xfc0000,
-	0x1000000, 0x202020202000000, 0x4020100804000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202020202000000, 0x0, 0x4020100804000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x202020202000000, 0x0, 0x0, 0x4020100804000000, 0x0, 0x0, 0x0, 0x0, 0x202020202000000, 0x0, 0x0,
-	0x0, 0x4020100804000000, 0x0, 0x0, 0x0, 0x202020202000000, 0x0, 0x0, 0x0, 0x0, 0x4020100804000000, 0x0, 0x201, 0x0, 0x404,
-	0x0, 0x810, 0x0, 0x0, 0x0, 0x0, 0x201, 0x404, 0x810, 0x0, 0x0, 0x0, 0x0, 0x30000, 0x30000, 0x0, 0xf80000, 0xf80000, 0xf80000,
-	0xf80000, 0xf80000, 0x0, 0x102000000, 0x404040404000000, 0x8040201008000000, 0x0, 0x0, 0x0, 0x0, 0x102000000, 0x0,
-	0x404040404000000, 0x0, 0x8040201008000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x404040404000000, 0x0, 0x0, 0x8040201008000000, 0x0,
-	0x0, 0x0, 0x0, 0x404040404000000, 0x0, 0x0, 0x0, 0x8040201008000000, 0x0, 0x0, 0x0, 0x404040404000000, 0x0, 0x0, 0x0, 0x0,
-	0x8040201008000000, 0x0, 0x402, 0x0, 0x808, 0x0, 0x1020, 0x0, 0x0, 0x0, 0x0, 0x402, 0x808, 0x1020, 0x0, 0x0, 0x0, 0x70000,
-	0x70000, 0x70000, 0x0, 0xf00000, 0xf00000, 0xf00000, 0xf00000, 0x0, 0x0, 0x10204000000, 0x808080808000000, 0x80402010000000,
-	0x0, 0x0, 0x0, 0x0, 0x10204000000, 0x0, 0x808080808000000, 0x0, 0x80402010000000, 0x0, 0x0, 0x10204000000, 0x0, 0x0,
-	0x808080808000000, 0x0, 0x0, 0x80402010000000, 0x0, 0x0, 0x0, 0x0, 0x808080808000000, 0x0, 0x0, 0x0, 0x80402010000000, 0x0,
-	0x0, 0x0, 0x808080808000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x804, 0x0, 0x1010, 0x0, 0x2040, 0x0, 0x0, 0x0, 0x0, 0x804, 0x1010,
-	0x2040, 0x0, 0x0, 0xf0000, 0xf0000, 0xf0000, 0xf0000, 0x0, 0xe00000, 0xe00000, 0xe00000, 0x0, 0x0, 0x0, 0x1020408000000,
-	0x1010101010000000, 0x804020000000, 0x0, 0x0, 0x0, 0x0, 0x1020408000000, 0x0, 0x1010101010000000, 0x0, 0x804020000000, 0x0,
-	0x0, 0x1020408000000, 0x0, 0x0, 0x1010101010000000, 0x0, 0x0, 0x804020000000, 0x1020408000000, 0x0, 0x0, 0x0,
-	0x1010101010000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010101010000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1008, 0x0, 0x2020,
-	0x0, 0x4080, 0x0, 0x0, 0x0, 0x0, 0x1008, 0x2020, 0x4080, 0x0, 0x1f0000, 0x1f0000, 0x1f0000, 0x1f0000, 0x1f0000, 0x0, 0xc00000,
-	0xc00000, 0x0, 0x0, 0x0, 0x0, 0x102040810000000, 0x2020202020000000, 0x8040000000, 0x0, 0x0, 0x0, 0x0, 0x102040810000000, 0x0,
-	0x2020202020000000, 0x0, 0x8040000000, 0x0, 0x0, 0x102040810000000, 0x0, 0x0, 0x2020202020000000, 0x0, 0x0, 0x0,
-	0x102040810000000, 0x0, 0x0, 0x0, 0x2020202020000000, 0x0, 0x0, 0x102040810000000, 0x0, 0x0, 0x0, 0x0, 0x2020202020000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2010, 0x0, 0x4040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2010, 0x4040, 0x8000, 0x3f0000, 0x3f0000,
-	0x3f0000, 0x3f0000, 0x3f0000, 0x3f0000, 0x0, 0x800000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x204081020000000, 0x4040404040000000,
-	0x80000000, 0x0, 0x0, 0x0, 0x0, 0x204081020000000, 0x0, 0x4040404040000000, 0x0, 0x0, 0x0, 0x0, 0x204081020000000, 0x0, 0x0,
-	0x4040404040000000, 0x0, 0x0, 0x0, 0x204081020000000, 0x0, 0x0, 0x0, 0x4040404040000000, 0x0, 0x0, 0x204081020000000, 0x0,
-	0x0, 0x0, 0x0, 0x4040404040000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4020, 0x0, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4020,
-	0x8080, 0x7f0000, 0x7f0000, 0x7f0000, 0x7f0000, 0x7f0000, 0x7f0000, 0x7f0000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x408102040000000, 0x8080808080000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x408102040000000, 0x0, 0x8080808080000000, 0x0, 0x0, 0x0,
-	0x0, 0x408102040000000, 0x0, 0x0, 0x8080808080000000, 0x0, 0x0, 0x0, 0x408102040000000, 0x0, 0x0, 0x0, 0x8080808080000000,
-	0x0, 0x0, 0x408102040000000, 0x0, 0x0, 0x0, 0x0, 0x8080808080000000, 0x10101, 0x0, 0x0, 0x20408, 0x0, 0x0, 0x0, 0x0, 0x10101,
-	0x0, 0x20408, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10101, 0x20408, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe000000, 0xfe000000,
-	0xfe000000, 0xfe000000, 0xfe000000, 0xfe000000, 0xfe000000, 0x101010100000000, 0x1008040200000000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x101010100000000, 0x0, 0x1008040200000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101010100000000, 0x0, 0x0, 0x1008040200000000,
-	0x0, 0x0, 0x0, 0x0, 0x101010100000000, 0x0, 0x0, 0x0, 0x1008040200000000, 0x0, 0x0, 0x0, 0x0, 0x20202, 0x0, 0x0, 0x40810, 0x0,
-	0x0, 0x0, 0x0, 0x20202, 0x0, 0x40810, 0x0, 0x0, 0x0, 0x0, 0x10000, 0x20202, 0x40810, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x0,
-	0xfc000000, 0xfc000000, 0xfc000000, 0xfc000000, 0xfc000000, 0xfc000000, 0x100000000, 0x202020200000000, 0x2010080400000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202020200000000, 0x0, 0x2010080400000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202020200000000, 0x0,
-	0x0, 0x2010080400000000, 0x0, 0x0, 0x0, 0x0, 0x202020200000000, 0x0, 0x0, 0x0, 0x2010080400000000, 0x0, 0x0, 0x0, 0x0,
-	0x40404, 0x0, 0x0, 0x81020, 0x0, 0x0, 0x20100, 0x0, 0x40404, 0x0, 0x81020, 0x0, 0x0, 0x0, 0x0, 0x20100, 0x40404, 0x81020, 0x0,
-	0x0, 0x0, 0x0, 0x3000000, 0x3000000, 0x0, 0xf8000000, 0xf8000000, 0xf8000000, 0xf8000000, 0xf8000000, 0x0, 0x10200000000,
-	0x404040400000000, 0x4020100800000000, 0x0, 0x0, 0x0, 0x0, 0x10200000000, 0x0, 0x404040400000000, 0x0, 0x4020100800000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x404040400000000, 0x0, 0x0, 0x4020100800000000, 0x0, 0x0, 0x0, 0x0, 0x404040400000000, 0x0, 0x0,
-	0x0, 0x4020100800000000, 0x0, 0x40201, 0x0, 0x0, 0x80808, 0x0, 0x0, 0x102040, 0x0, 0x0, 0x40201, 0x0, 0x80808, 0x0, 0x102040,
-	0x0, 0x0, 0x0, 0x0, 0x40201, 0x80808, 0x102040, 0x0, 0x0, 0x0, 0x7000000, 0x7000000, 0x7000000, 0x0, 0xf0000000, 0xf0000000,
-	0xf0000000, 0xf0000000, 0x0, 0x0, 0x1020400000000, 0x808080800000000, 0x8040201000000000, 0x0, 0x0, 0x0, 0x0, 0x1020400000000,
-	0x0, 0x808080800000000, 0x0, 0x8040201000000000, 0x0, 0x0, 0x1020400000000, 0x0, 0x0, 0x808080800000000, 0x0, 0x0,
-	0x8040201000000000, 0x0, 0x0, 0x0, 0x0, 0x808080800000000, 0x0, 0x0, 0x0, 0x8040201000000000, 0x0, 0x80402, 0x0, 0x0,
-	0x101010, 0x0, 0x0, 0x204080, 0x0, 0x0, 0x80402, 0x0, 0x101010, 0x0, 0x204080, 0x0, 0x0, 0x0, 0x0, 0x80402, 0x101010,
-	0x204080, 0x0, 0x0, 0xf000000, 0xf000000, 0xf000000, 0xf000000, 0x0, 0xe0000000, 0xe0000000, 0xe0000000, 0x0, 0x0, 0x0,
-	0x102040800000000, 0x1010101000000000, 0x80402000000000, 0x0, 0x0, 0x0, 0x0, 0x102040800000000, 0x0, 0x1010101000000000, 0x0,
-	0x80402000000000, 0x0, 0x0, 0x102040800000000, 0x0, 0x0, 0x1010101000000000, 0x0, 0x0, 0x80402000000000, 0x102040800000000,
-	0x0, 0x0, 0x0, 0x1010101000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100804, 0x0, 0x0, 0x202020, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100804,
-	0x0, 0x202020, 0x0, 0x408000, 0x0, 0x0, 0x0, 0x0, 0x100804, 0x202020, 0x408000, 0x0, 0x1f000000, 0x1f000000, 0x1f000000,
-	0x1f000000, 0x1f000000, 0x0, 0xc0000000, 0xc0000000, 0x0, 0x0, 0x0, 0x0, 0x204081000000000, 0x2020202000000000,
-	0x804000000000, 0x0, 0x0, 0x0, 0x0, 0x204081000000000, 0x0, 0x2020202000000000, 0x0, 0x804000000000, 0x0, 0x0,
-	0x204081000000000, 0x0, 0x0, 0x2020202000000000, 0x0, 0x0, 0x0, 0x204081000000000, 0x0, 0x0, 0x0, 0x2020202000000000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x201008, 0x0, 0x0, 0x404040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x201008, 0x0, 0x404040, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x201008, 0x404040, 0x800000, 0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000, 0x3f000000, 0x0, 0x80000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x408102000000000, 0x4040404000000000, 0x8000000000, 0x0, 0x0, 0x0, 0x0, 0x408102000000000, 0x0,
-	0x4040404000000000, 0x0, 0x0, 0x0, 0x0, 0x408102000000000, 0x0, 0x0, 0x4040404000000000, 0x0, 0x0, 0x0, 0x408102000000000,
-	0x0, 0x0, 0x0, 0x4040404000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x402010, 0x0, 0x0, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x402010,
-	0x0, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x402010, 0x808080, 0x7f000000, 0x7f000000, 0x7f000000, 0x7f000000, 0x7f000000,
-	0x7f000000, 0x7f000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x810204000000000, 0x8080808000000000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x810204000000000, 0x0, 0x8080808000000000, 0x0, 0x0, 0x0, 0x0, 0x810204000000000, 0x0, 0x0, 0x8080808000000000, 0x0, 0x0,
-	0x0, 0x810204000000000, 0x0, 0x0, 0x0, 0x8080808000000000, 0x1010101, 0x0, 0x0, 0x0, 0x2040810, 0x0, 0x0, 0x0, 0x1010101, 0x0,
-	0x0, 0x2040810, 0x0, 0x0, 0x0, 0x0, 0x1010101, 0x0, 0x2040810, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010101, 0x2040810, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0xfe00000000, 0xfe00000000, 0xfe00000000, 0xfe00000000, 0xfe00000000, 0xfe00000000, 0xfe00000000,
-	0x101010000000000, 0x804020000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101010000000000, 0x0, 0x804020000000000, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x101010000000000, 0x0, 0x0, 0x804020000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2020202, 0x0, 0x0, 0x0, 0x4081020, 0x0,
-	0x0, 0x0, 0x2020202, 0x0, 0x0, 0x4081020, 0x0, 0x0, 0x0, 0x0, 0x2020202, 0x0, 0x4081020, 0x0, 0x0, 0x0, 0x0, 0x1000000,
-	0x2020202, 0x4081020, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100000000, 0x0, 0xfc00000000, 0xfc00000000, 0xfc00000000, 0xfc00000000,
-	0xfc00000000, 0xfc00000000, 0x10000000000, 0x202020000000000, 0x1008040000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x202020000000000, 0x0, 0x1008040000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202020000000000, 0x0, 0x0, 0x1008040000000000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x4040404, 0x0, 0x0, 0x0, 0x8102040, 0x0, 0x0, 0x0, 0x4040404, 0x0, 0x0, 0x8102040, 0x0, 0x0, 0x2010000,
-	0x0, 0x4040404, 0x0, 0x8102040, 0x0, 0x0, 0x0, 0x0, 0x2010000, 0x4040404, 0x8102040, 0x0, 0x0, 0x0, 0x0, 0x300000000,
-	0x300000000, 0x0, 0xf800000000, 0xf800000000, 0xf800000000, 0xf800000000, 0xf800000000, 0x0, 0x1020000000000,
-	0x404040000000000, 0x2010080000000000, 0x0, 0x0, 0x0, 0x0, 0x1020000000000, 0x0, 0x404040000000000, 0x0, 0x2010080000000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x404040000000000, 0x0, 0x0, 0x2010080000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8080808, 0x0, 0x0, 0x0,
-	0x10204080, 0x4020100, 0x0, 0x0, 0x8080808, 0x0, 0x0, 0x10204080, 0x0, 0x0, 0x4020100, 0x0, 0x8080808, 0x0, 0x10204080, 0x0,
-	0x0, 0x0, 0x0, 0x4020100, 0x8080808, 0x10204080, 0x0, 0x0, 0x0, 0x700000000, 0x700000000, 0x700000000, 0x0, 0xf000000000,
-	0xf000000000, 0xf000000000, 0xf000000000, 0x0, 0x0, 0x102040000000000, 0x808080000000000, 0x4020100000000000, 0x0, 0x0, 0x0,
-	0x0, 0x102040000000000, 0x0, 0x808080000000000, 0x0, 0x4020100000000000, 0x0, 0x0, 0x102040000000000, 0x0, 0x0,
-	0x808080000000000, 0x0, 0x0, 0x4020100000000000, 0x0, 0x8040201, 0x0, 0x0, 0x0, 0x10101010, 0x0, 0x0, 0x0, 0x0, 0x8040201,
-	0x0, 0x0, 0x10101010, 0x0, 0x0, 0x20408000, 0x0, 0x0, 0x8040201, 0x0, 0x10101010, 0x0, 0x20408000, 0x0, 0x0, 0x0, 0x0,
-	0x8040201, 0x10101010, 0x20408000, 0x0, 0x0, 0xf00000000, 0xf00000000, 0xf00000000, 0xf00000000, 0x0, 0xe000000000,
-	0xe000000000, 0xe000000000, 0x0, 0x0, 0x0, 0x204080000000000, 0x1010100000000000, 0x8040200000000000, 0x0, 0x0, 0x0, 0x0,
-	0x204080000000000, 0x0, 0x1010100000000000, 0x0, 0x8040200000000000, 0x0, 0x0, 0x204080000000000, 0x0, 0x0,
-	0x1010100000000000, 0x0, 0x0, 0x8040200000000000, 0x0, 0x10080402, 0x0, 0x0, 0x0, 0x20202020, 0x0, 0x0, 0x0, 0x0, 0x10080402,
-	0x0, 0x0, 0x20202020, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10080402, 0x0, 0x20202020, 0x0, 0x40800000, 0x0, 0x0, 0x0, 0x0, 0x10080402,
-	0x20202020, 0x40800000, 0x0, 0x1f00000000, 0x1f00000000, 0x1f00000000, 0x1f00000000, 0x1f00000000, 0x0, 0xc000000000,
-	0xc000000000, 0x0, 0x0, 0x0, 0x0, 0x408100000000000, 0x2020200000000000, 0x80400000000000, 0x0, 0x0, 0x0, 0x0,
-	0x408100000000000, 0x0, 0x2020200000000000, 0x0, 0x80400000000000, 0x0, 0x0, 0x408100000000000, 0x0, 0x0, 0x2020200000000000,
-	0x0, 0x0, 0x0, 0x0, 0x20100804, 0x0, 0x0, 0x0, 0x40404040, 0x0, 0x0, 0x0, 0x0, 0x20100804, 0x0, 0x0, 0x40404040, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x20100804, 0x0, 0x40404040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20100804, 0x40404040, 0x80000000, 0x3f00000000,
-	0x3f00000000, 0x3f00000000, 0x3f00000000, 0x3f00000000, 0x3f00000000, 0x0, 0x8000000000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x810200000000000, 0x4040400000000000, 0x800000000000, 0x0, 0x0, 0x0, 0x0, 0x810200000000000, 0x0, 0x4040400000000000, 0x0,
-	0x0, 0x0, 0x0, 0x810200000000000, 0x0, 0x0, 0x4040400000000000, 0x0, 0x0, 0x0, 0x0, 0x40201008, 0x0, 0x0, 0x0, 0x80808080,
-	0x0, 0x0, 0x0, 0x0, 0x40201008, 0x0, 0x0, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40201008, 0x0, 0x80808080, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x40201008, 0x80808080, 0x7f00000000, 0x7f00000000, 0x7f00000000, 0x7f00000000, 0x7f00000000, 0x7f00000000,
-	0x7f00000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1020400000000000, 0x8080800000000000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x1020400000000000, 0x0, 0x8080800000000000, 0x0, 0x0, 0x0, 0x0, 0x1020400000000000, 0x0, 0x0, 0x8080800000000000,
-	0x101010101, 0x0, 0x0, 0x0, 0x0, 0x204081020, 0x0, 0x0, 0x101010101, 0x0, 0x0, 0x0, 0x204081020, 0x0, 0x0, 0x0, 0x101010101,
-	0x0, 0x0, 0x204081020, 0x0, 0x0, 0x0, 0x0, 0x101010101, 0x0, 0x204081020, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101010101, 0x204081020,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe0000000000, 0xfe0000000000, 0xfe0000000000, 0xfe0000000000, 0xfe0000000000,
-	0xfe0000000000, 0xfe0000000000, 0x101000000000000, 0x402000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101000000000000, 0x0,
-	0x402000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202020202, 0x0, 0x0, 0x0, 0x0, 0x408102040, 0x0, 0x0, 0x202020202, 0x0,
-	0x0, 0x0, 0x408102040, 0x0, 0x0, 0x0, 0x202020202, 0x0, 0x0, 0x408102040, 0x0, 0x0, 0x0, 0x0, 0x202020202, 0x0, 0x408102040,
-	0x0, 0x0, 0x0, 0x0, 0x100000000, 0x202020202, 0x408102040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10000000000, 0x0, 0xfc0000000000,
-	0xfc0000000000, 0xfc0000000000, 0xfc0000000000, 0xfc0000000000, 0xfc0000000000, 0x1000000000000, 0x202000000000000,
-	0x804000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202000000000000, 0x0, 0x804000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x404040404, 0x0, 0x0, 0x0, 0x0, 0x810204080, 0x0, 0x0, 0x404040404, 0x0, 0x0, 0x0, 0x810204080, 0x0, 0x0, 0x0, 0x404040404,
-	0x0, 0x0, 0x810204080, 0x0, 0x0, 0x201000000, 0x0, 0x404040404, 0x0, 0x810204080, 0x0, 0x0, 0x0, 0x0, 0x201000000,
-	0x404040404, 0x810204080, 0x0, 0x0, 0x0, 0x0, 0x30000000000, 0x30000000000, 0x0, 0xf80000000000, 0xf80000000000,
-	0xf80000000000, 0xf80000000000, 0xf80000000000, 0x0, 0x102000000000000, 0x404000000000000, 0x1008000000000000, 0x0, 0x0, 0x0,
-	0x0, 0x102000000000000, 0x0, 0x404000000000000, 0x0, 0x1008000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x808080808, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x808080808, 0x0, 0x0, 0x0, 0x1020408000, 0x402010000, 0x0, 0x0, 0x808080808, 0x0, 0x0, 0x1020408000,
-	0x0, 0x0, 0x402010000, 0x0, 0x808080808, 0x0, 0x1020408000, 0x0, 0x0, 0x0, 0x0, 0x402010000, 0x808080808, 0x1020408000, 0x0,
-	0x0, 0x0, 0x70000000000, 0x70000000000, 0x70000000000, 0x0, 0xf00000000000, 0xf00000000000, 0xf00000000000, 0xf00000000000,
-	0x0, 0x0, 0x204000000000000, 0x808000000000000, 0x2010000000000000, 0x0, 0x0, 0x0, 0x0, 0x204000000000000, 0x0,
-	0x808000000000000, 0x0, 0x2010000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010101010, 0x0, 0x0, 0x0, 0x804020100, 0x0, 0x0,
-	0x0, 0x1010101010, 0x0, 0x0, 0x0, 0x0, 0x804020100, 0x0, 0x0, 0x1010101010, 0x0, 0x0, 0x2040800000, 0x0, 0x0, 0x804020100,
-	0x0, 0x1010101010, 0x0, 0x2040800000, 0x0, 0x0, 0x0, 0x0, 0x804020100, 0x1010101010, 0x2040800000, 0x0, 0x0, 0xf0000000000,
-	0xf0000000000, 0xf0000000000, 0xf0000000000, 0x0, 0xe00000000000, 0xe00000000000, 0xe00000000000, 0x0, 0x0, 0x0,
-	0x408000000000000, 0x1010000000000000, 0x4020000000000000, 0x0, 0x0, 0x0, 0x0, 0x408000000000000, 0x0, 0x1010000000000000,
-	0x0, 0x4020000000000000, 0x0, 0x1008040201, 0x0, 0x0, 0x0, 0x0, 0x2020202020, 0x0, 0x0, 0x0, 0x1008040201, 0x0, 0x0, 0x0,
-	0x2020202020, 0x0, 0x0, 0x0, 0x0, 0x1008040201, 0x0, 0x0, 0x2020202020, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1008040201, 0x0,
-	0x2020202020, 0x0, 0x4080000000, 0x0, 0x0, 0x0, 0x0, 0x1008040201, 0x2020202020, 0x4080000000, 0x0, 0x1f0000000000,
-	0x1f0000000000, 0x1f0000000000, 0x1f0000000000, 0x1f0000000000, 0x0, 0xc00000000000, 0xc00000000000, 0x0, 0x0, 0x0, 0x0,
-	0x810000000000000, 0x2020000000000000, 0x8040000000000000, 0x0, 0x0, 0x0, 0x0, 0x810000000000000, 0x0, 0x2020000000000000,
-	0x0, 0x8040000000000000, 0x0, 0x2010080402, 0x0, 0x0, 0x0, 0x0, 0x4040404040, 0x0, 0x0, 0x0, 0x2010080402, 0x0, 0x0, 0x0,
-	0x4040404040, 0x0, 0x0, 0x0, 0x0, 0x2010080402, 0x0, 0x0, 0x4040404040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2010080402, 0x0,
-	0x4040404040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2010080402, 0x4040404040, 0x8000000000, 0x3f0000000000, 0x3f0000000000,
-	0x3f0000000000, 0x3f0000000000, 0x3f0000000000, 0x3f0000000000, 0x0, 0x800000000000, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x1020000000000000, 0x4040000000000000, 0x80000000000000, 0x0, 0x0, 0x0, 0x0, 0x1020000000000000, 0x0, 0x4040000000000000,
-	0x0, 0x0, 0x0, 0x4020100804, 0x0, 0x0, 0x0, 0x0, 0x8080808080, 0x0, 0x0, 0x0, 0x4020100804, 0x0, 0x0, 0x0, 0x8080808080, 0x0,
-	0x0, 0x0, 0x0, 0x4020100804, 0x0, 0x0, 0x8080808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4020100804, 0x0, 0x8080808080, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x4020100804, 0x8080808080, 0x7f0000000000, 0x7f0000000000, 0x7f0000000000, 0x7f0000000000, 0x7f0000000000,
-	0x7f0000000000, 0x7f0000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2040000000000000, 0x8080000000000000, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x2040000000000000, 0x0, 0x8080000000000000, 0x10101010101, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20408102040, 0x0, 0x10101010101,
-	0x0, 0x0, 0x0, 0x0, 0x20408102040, 0x0, 0x0, 0x10101010101, 0x0, 0x0, 0x0, 0x20408102040, 0x0, 0x0, 0x0, 0x10101010101, 0x0,
-	0x0, 0x20408102040, 0x0, 0x0, 0x0, 0x0, 0x10101010101, 0x0, 0x20408102040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10101010101,
-	0x20408102040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe000000000000, 0xfe000000000000, 0xfe000000000000, 0xfe000000000000,
-	0xfe000000000000, 0xfe000000000000, 0xfe000000000000, 0x100000000000000, 0x200000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x20202020202, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40810204080, 0x0, 0x20202020202, 0x0, 0x0, 0x0, 0x0, 0x40810204080, 0x0, 0x0,
-	0x20202020202, 0x0, 0x0, 0x0, 0x40810204080, 0x0, 0x0, 0x0, 0x20202020202, 0x0, 0x0, 0x40810204080, 0x0, 0x0, 0x0, 0x0,
-	0x20202020202, 0x0, 0x40810204080, 0x0, 0x0, 0x0, 0x0, 0x10000000000, 0x20202020202, 0x40810204080, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x1000000000000, 0x0, 0xfc000000000000, 0xfc000000000000, 0xfc000000000000, 0xfc000000000000, 0xfc000000000000,
-	0xfc000000000000, 0x100000000000000, 0x200000000000000, 0x400000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40404040404,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40404040404, 0x0, 0x0, 0x0, 0x0, 0x81020408000, 0x0, 0x0, 0x40404040404, 0x0, 0x0, 0x0,
-	0x81020408000, 0x0, 0x0, 0x0, 0x40404040404, 0x0, 0x0, 0x81020408000, 0x0, 0x0, 0x20100000000, 0x0, 0x40404040404, 0x0,
-	0x81020408000, 0x0, 0x0, 0x0, 0x0, 0x20100000000, 0x40404040404, 0x81020408000, 0x0, 0x0, 0x0, 0x0, 0x3000000000000,
-	0x3000000000000, 0x0, 0xf8000000000000, 0xf8000000000000, 0xf8000000000000, 0xf8000000000000, 0xf8000000000000, 0x0,
-	0x200000000000000, 0x400000000000000, 0x800000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80808080808, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x80808080808, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80808080808, 0x0, 0x0, 0x0, 0x102040800000, 0x40201000000,
-	0x0, 0x0, 0x80808080808, 0x0, 0x0, 0x102040800000, 0x0, 0x0, 0x40201000000, 0x0, 0x80808080808, 0x0, 0x102040800000, 0x0, 0x0,
-	0x0, 0x0, 0x40201000000, 0x80808080808, 0x102040800000, 0x0, 0x0, 0x0, 0x7000000000000, 0x7000000000000, 0x7000000000000, 0x0,
-	0xf0000000000000, 0xf0000000000000, 0xf0000000000000, 0xf0000000000000, 0x0, 0x0, 0x400000000000000, 0x800000000000000,
-	0x1000000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101010101010, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101010101010, 0x0,
-	0x0, 0x0, 0x80402010000, 0x0, 0x0, 0x0, 0x101010101010, 0x0, 0x0, 0x0, 0x0, 0x80402010000, 0x0, 0x0, 0x101010101010, 0x0, 0x0,
-	0x204080000000, 0x0, 0x0, 0x80402010000, 0x0, 0x101010101010, 0x0, 0x204080000000, 0x0, 0x0, 0x0, 0x0, 0x80402010000,
-	0x101010101010, 0x204080000000, 0x0, 0x0, 0xf000000000000, 0xf000000000000, 0xf000000000000, 0xf000000000000, 0x0,
-	0xe0000000000000, 0xe0000000000000, 0xe0000000000000, 0x0, 0x0, 0x0, 0x800000000000000, 0x1000000000000000,
-	0x2000000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x202020202020, 0x0, 0x0, 0x100804020100, 0x0, 0x0, 0x0, 0x0,
-	0x202020202020, 0x0, 0x0, 0x0, 0x100804020100, 0x0, 0x0, 0x0, 0x202020202020, 0x0, 0x0, 0x0, 0x0, 0x100804020100, 0x0, 0x0,
-	0x202020202020, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100804020100, 0x0, 0x202020202020, 0x0, 0x408000000000, 0x0, 0x0, 0x0, 0x0,
-	0x100804020100, 0x202020202020, 0x408000000000, 0x0, 0x1f000000000000, 0x1f000000000000, 0x1f000000000000, 0x1f000000000000,
-	0x1f000000000000, 0x0, 0xc0000000000000, 0xc0000000000000, 0x0, 0x0, 0x0, 0x0, 0x1000000000000000, 0x2000000000000000,
-	0x4000000000000000, 0x0, 0x201008040201, 0x0, 0x0, 0x0, 0x0, 0x0, 0x404040404040, 0x0, 0x0, 0x201008040201, 0x0, 0x0, 0x0,
-	0x0, 0x404040404040, 0x0, 0x0, 0x0, 0x201008040201, 0x0, 0x0, 0x0, 0x404040404040, 0x0, 0x0, 0x0, 0x0, 0x201008040201, 0x0,
-	0x0, 0x404040404040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x201008040201, 0x0, 0x404040404040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x201008040201, 0x404040404040, 0x800000000000, 0x3f000000000000, 0x3f000000000000, 0x3f000000000000, 0x3f000000000000,
-	0x3f000000000000, 0x3f000000000000, 0x0, 0x80000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000000000000000, 0x4000000000000000,
-	0x8000000000000000, 0x0, 0x402010080402, 0x0, 0x0, 0x0, 0x0, 0x0, 0x808080808080, 0x0, 0x0, 0x402010080402, 0x0, 0x0, 0x0,
-	0x0, 0x808080808080, 0x0, 0x0, 0x0, 0x402010080402, 0x0, 0x0, 0x0, 0x808080808080, 0x0, 0x0, 0x0, 0x0, 0x402010080402, 0x0,
-	0x0, 0x808080808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x402010080402, 0x0, 0x808080808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x402010080402, 0x808080808080, 0x7f000000000000, 0x7f000000000000, 0x7f000000000000, 0x7f000000000000, 0x7f000000000000,
-	0x7f000000000000, 0x7f000000000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000000000000000, 0x8000000000000000,
-	0x1010101010101, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2040810204080, 0x1010101010101, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2040810204080,
-	0x0, 0x1010101010101, 0x0, 0x0, 0x0, 0x0, 0x2040810204080, 0x0, 0x0, 0x1010101010101, 0x0, 0x0, 0x0, 0x2040810204080, 0x0,
-	0x0, 0x0, 0x1010101010101, 0x0, 0x0, 0x2040810204080, 0x0, 0x0, 0x0, 0x0, 0x1010101010101, 0x0, 0x2040810204080, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x1010101010101, 0x2040810204080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe00000000000000, 0xfe00000000000000,
-	0xfe00000000000000, 0xfe00000000000000, 0xfe00000000000000, 0xfe00000000000000, 0xfe00000000000000, 0x0, 0x2020202020202, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2020202020202, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4081020408000, 0x0, 0x2020202020202, 0x0, 0x0, 0x0,
-	0x0, 0x4081020408000, 0x0, 0x0, 0x2020202020202, 0x0, 0x0, 0x0, 0x4081020408000, 0x0, 0x0, 0x0, 0x2020202020202, 0x0, 0x0,
-	0x4081020408000, 0x0, 0x0, 0x0, 0x0, 0x2020202020202, 0x0, 0x4081020408000, 0x0, 0x0, 0x0, 0x0, 0x1000000000000,
-	0x2020202020202, 0x4081020408000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100000000000000, 0x0, 0xfc00000000000000, 0xfc00000000000000,
-	0xfc00000000000000, 0xfc00000000000000, 0xfc00000000000000, 0xfc00000000000000, 0x0, 0x0, 0x4040404040404, 0x0, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x4040404040404, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4040404040404, 0x0, 0x0, 0x0, 0x0, 0x8102040800000, 0x0,
-	0x0, 0x4040404040404, 0x0, 0x0, 0x0, 0x8102040800000, 0x0, 0x0, 0x0, 0x4040404040404, 0x0, 0x0, 0x8102040800000, 0x0, 0x0,
-	0x2010000000000, 0x0, 0x4040404040404, 0x0, 0x8102040800000, 0x0, 0x0, 0x0, 0x0, 0x2010000000000, 0x4040404040404,
-	0x8102040800000, 0x0, 0x0, 0x0, 0x0, 0x300000000000000, 0x300000000000000, 0x0, 0xf800000000000000, 0xf800000000000000,
-	0xf800000000000000, 0xf800000000000000, 0xf800000000000000, 0x0, 0x0, 0x0, 0x8080808080808, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-	0x8080808080808, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8080808080808, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8080808080808, 0x0,
-	0x0, 0x0, 0x10204080000000, 0x4020100000000, 0x0, 0x0, 0x8080808080808, 0x0, 0x0, 0x10204080000000, 0x0, 0x0, 0x4020100000000,
-	0x0, 0x8080808080808, 0x0, 0x10204080000000, 0x0, 0x0, 0x0, 0x0, 0x4020100000000, 0x8080808080808, 0x10204080000000, 0x0, 0x0,
-	0x0, 0x700000000000000, 0x700000000000000, 0x700000000000000, 0x0, 0xf000000000000000, 0xf000000000000000, 0xf000000000000000,
-	0xf000000000000000, 0x0, 0x0, 0x0, 0x0, 0x10101010101010, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10101010101010, 0x0, 0x0, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x10101010101010, 0x0, 0x0, 0x0, 0x8040201000000, 0x0, 0x0, 0x0, 0x10101010101010, 0x0, 0x0, 0x0, 0x0,
-	0x8040201000000, 0x0, 0x0, 0x10101010101010, 0x0, 0x0, 0x20408000000000, 0x0, 0x0, 0x8040201000000, 0x0, 0x10101010101010,
-	0x0, 0x20408000000000, 0x0, 0x0, 0x0, 0x0, 0x8040201000000, 0x10101010101010, 0x20408000000000, 0x0, 0x0, 0xf00000000000000,
-	0xf00000000000000, 0xf00000000000000, 0xf00000000000000, 0x0, 0xe000000000000000, 0xe000000000000000, 0xe000000000000000, 0x0,
-	0x0, 0x0, 0x0, 0x0, 0x20202020202020, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20202020202020, 0x0, 0x0, 0x10080402010000, 0x0,
-	0x0, 0x0, 0x0, 0x20202020202020, 0x0, 0x0, 0x0, 0x10080402010000, 0x0, 0x0, 0x0, 0x20202020202020, 0x0, 0x0, 0x0, 0x0,
-	0x10080402010000, 0x0, 0x0, 0x20202020202020, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10080402010000, 0x0, 0x20202020202020, 0x0,
-	0x40800000000000, 0x0, 0x0, 0x0, 0x0, 0x10080402010000, 0x20202020202020, 0x40800000000000, 0x0, 0x1f00000000000000,
-	0x1f00000000000000, 0x1f00000000000000, 0x1f00000000000000, 0x1f00000000000000, 0x0, 0xc000000000000000, 0xc000000000000000,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40404040404040, 0x0, 0x20100804020100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40404040404040, 0x0, 0x0,
-	0x20100804020100, 0x0, 0x0, 0x0, 0x0, 0x40404040404040, 0x0, 0x0, 0x0, 0x20100804020100, 0x0, 0x0, 0x0, 0x40404040404040, 0x0,
-	0x0, 0x0, 0x0, 0x20100804020100, 0x0, 0x0, 0x40404040404040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20100804020100, 0x0, 0x40404040404040,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20100804020100, 0x40404040404040, 0x80000000000000, 0x3f00000000000000, 0x3f00000000000000,
-	0x3f00000000000000, 0x3f00000000000000, 0x3f00000000000000, 0x3f00000000000000, 0x0, 0x8000000000000000, 0x40201008040201,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80808080808080, 0x0, 0x40201008040201, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80808080808080, 0x0, 0x0,
-	0x40201008040201, 0x0, 0x0, 0x0, 0x0, 0x80808080808080, 0x0, 0x0, 0x0, 0x40201008040201, 0x0, 0x0, 0x0, 0x80808080808080, 0x0,
-	0x0, 0x0, 0x0, 0x40201008040201, 0x0, 0x0, 0x80808080808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40201008040201, 0x0, 0x80808080808080,
-	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40201008040201, 0x80808080808080, 0x7f00000000000000, 0x7f00000000000000, 0x7f00000000000000,
-	0x7f00000000000000, 0x7f00000000000000, 0x7f00000000000000, 0x7f00000000000000, 0x0,
-};
+	RayTables tables{ };
+
+	for ( int from = 0; from < 64; from++ ) {
+		for ( const auto &direction : directions ) {
+			uint64_t ray = 0;
+			int rank = from / 8 + direction[0];
+			int file = from % 8 + direction[1];
+
+			for ( ; rank >= 0 && rank < 8 && file >= 0 && file < 8; rank += direction[0], file += direction[1] ) {
+				ray |= 1ull << ( rank * 8 + file );
+				tables.m_Rays[from * 64 + rank * 8 + file] = ray;
+			}
+
+			for ( uint64_t squares = ray; squares; squares &= squares - 1 ) {
+				tables.m_XRays[from * 64 + std::countr_zero( squares )] = ray;
+			}
+		}
+	}
+
+	return tables;
+}
+
+static constexpr RayTables RAY_TABLES = GenerateRayTables();
+
+static constexpr const std::array<uint64_t, 4096> &RAYS = RAY_TABLES.m_Rays;
+static constexpr const std::array<uint64_t, 4096> &XRAYS = RAY_TABLES.m_XRays;
@@ -1,6 +1,5 @@
 #pragma once
 
-#if !PEXT
 static constexpr uint8_t ROOK_OCCUPANCY_COUNT[64]{
 	0xc, 0xb, 0xb, 0xb, 0xb, 0xb, 0xb, 0xc, 0xb, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xb, 0xb, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
 	0xb, 0xb, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xb, 0xb, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xb, 0xb, 0xa, 0xa, 0xa, 0xa, 0xa,
@@ -19,7 +18,18 @@ static constexpr uint64_t ROOK_MAGICS[64]{
 	0x121000200040100, 0x4840c0181304200, 0x201100408202, 0x38850410204001, 0x7014221201800842, 0x210742019009001,
 	0x409600600418306a, 0x1000802040001, 0x240014208102084, 0x1410108100204402,
 };
-#endif
+
+// Each square's slice of the attack table holds 2^occupancy count entries instead of a fixed 4096.
+static constexpr uint32_t ROOK_OFFSETS[64]{
+	0, 4096, 6144, 8192, 10240, 12288, 14336, 16384, 20480, 22528, 23552, 24576,
+	25600, 26624, 27648, 28672, 30720, 32768, 33792, 34816, 35840, 36864, 37888, 38912,
+	40960, 43008, 44032, 45056, 46080, 47104, 48128, 49152, 51200, 53248, 54272, 55296,
+	56320, 57344, 58368, 59392, 61440, 63488, 64512, 65536, 66560, 67584, 68608, 69632,
+	71680, 73728, 74752, 75776, 76800, 77824, 78848, 79872, 81920, 86016, 88064, 90112,
+	92160, 94208, 96256, 98304,
+};
+
+static constexpr uint32_t ROOK_TABLE_SIZE = 102400;
 
 static constexpr uint64_t ROOK_MASKS[64]{
 	0x101010101017e, 0x202020202027c, 0x404040404047a, 0x8080808080876, 0x1010101010106e, 0x2020202020205e,
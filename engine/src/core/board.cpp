@@ -3,7 +3,9 @@
 #include "KitsuneEngine/console_colors.h"
 #include "KitsuneEngine/core/fen.h"
 
+#include <algorithm>
 #include <format>
+#include <utility>
 
 #include "KitsuneEngine/core/attacks/attacks.h"
 
@@ -22,6 +24,16 @@ Board::Board() {
 	m_Pieces[KING].SetBit( E1 );
 	m_Pieces[KING].SetBit( E8 );
 
+	for ( int square = 0; square < 64; square++ ) {
+		m_Mailbox[square] = NULL_PIECE;
+	}
+
+	for ( int piece = PAWN; piece <= KING; piece++ ) {
+		m_Pieces[piece].Map( [this, piece]( const Square square ) {
+			m_Mailbox[square] = static_cast<PieceType>(piece);
+		} );
+	}
+
 	m_enPassantSquare = NULL_SQUARE;
 
 	m_Side = WHITE;
@@ -36,10 +48,19 @@ Board::Board() {
 	m_Rooks[2] = A8;
 	m_Rooks[3] = H8;
 
-	m_Hash = 0x325BF1EB13D84627;
+	m_Hash = ComputeHash();
+	m_PawnHash = ComputePawnHash();
+	m_PsqtScore = ComputePsqtScore();
 }
 
 Board::Board( const FEN &fen ) {
+	m_Phase = 0;
+	m_PsqtScore = 0;
+
+	for ( int square = 0; square < 64; square++ ) {
+		m_Mailbox[square] = NULL_PIECE;
+	}
+
 	for ( int rankIndex = 0; rankIndex < 8; ++rankIndex ) {
 		std::string rank = fen.GetBoardRow( rankIndex );
 		for ( uint8_t file = 0, index = 0; file < 8; file++, index++ ) {
@@ -108,6 +129,9 @@ Board::Board( const FEN &fen ) {
 	}
 
 	m_HalfMoves = std::stoi( fen.GetHalfMoveCounter() );
+
+	m_Hash = ComputeHash();
+	m_PawnHash = ComputePawnHash();
 }
 
 bool Board::IsInsufficientMaterial() const {
@@ -118,6 +142,149 @@ bool Board::IsInsufficientMaterial() const {
 			                                         bishops & 0xAA55AA55AA55AA55 ) == bishops ) ) );
 }
 
+// The piece left standing on the target square and the material the move itself gains.
+static std::pair<PieceType, int32_t> GetSeeStart( const Board &board, const Move &move ) {
+	PieceType standing = board.GetPieceOnSquare( move.GetFromSquare() );
+	int32_t gain = 0;
+	if ( move.IsEnPassant() ) {
+		gain = SEE_VALUES[PAWN];
+	} else if ( move.IsCapture() ) {
+		gain = SEE_VALUES[board.GetPieceOnSquare( move.GetToSquare() )];
+	}
+
+	if ( move.IsPromotion() ) {
+		standing = move.GetPromotionPieceType();
+		gain += SEE_VALUES[standing] - SEE_VALUES[PAWN];
+	}
+
+	return { standing, gain };
+}
+
+static Bitboard GetSeeOccupancy( const Board &board, const Move &move ) {
+	Bitboard occupancy = board.GetOccupancy();
+	occupancy.PopBit( move.GetFromSquare() );
+	occupancy.SetBit( move.GetToSquare() );
+	if ( move.IsEnPassant() ) {
+		occupancy.PopBit( move.GetToSquare() ^ 8 );
+	}
+
+	return occupancy;
+}
+
+// Takes the side's least valuable attacker off the occupancy. Sliders lined up behind it join the attackers, which is
+// how x-rays are found without tracing them separately.
+static PieceType PopLeastValuableAttacker( const Board &board, const Square square, const Bitboard sideAttackers,
+                                           Bitboard &occupancy, Bitboard &attackers ) {
+	for ( int piece = PAWN; piece <= KING; piece++ ) {
+		const auto pieceType = static_cast<PieceType>(piece);
+		const Bitboard candidates = sideAttackers & board.GetPieceMask( pieceType );
+		if ( !candidates ) {
+			continue;
+		}
+
+		occupancy.PopBit( candidates.Ls1bSquare() );
+		const Bitboard queens = board.GetPieceMask( QUEEN );
+		if ( pieceType == PAWN || pieceType == BISHOP || pieceType == QUEEN ) {
+			attackers |= Attacks::GetBishopAttacks( square, occupancy ) & ( board.GetPieceMask( BISHOP ) | queens );
+		}
+		if ( pieceType == ROOK || pieceType == QUEEN ) {
+			attackers |= Attacks::GetRookAttacks( square, occupancy ) & ( board.GetPieceMask( ROOK ) | queens );
+		}
+
+		attackers &= occupancy;
+		return pieceType;
+	}
+
+	return NULL_PIECE;
+}
+
+int32_t Board::See( const Move &move ) const {
+	if ( move.IsCastle() ) {
+		return 0;
+	}
+
+	const Square toSquare = move.GetToSquare();
+	auto [standing, gain] = GetSeeStart( *this, move );
+	Bitboard occupancy = GetSeeOccupancy( *this, move );
+	Bitboard attackers = Attacks::AllAttackersToSquare( *this, toSquare, occupancy ) & occupancy;
+
+	// gains[i] is what the side making capture i wins if the exchange stops right after it.
+	int32_t gains[32];
+	gains[0] = gain;
+	uint8_t depth = 0;
+
+	SideToMove side = m_Side;
+	while ( true ) {
+		side = ~side;
+		const Bitboard sideAttackers = attackers & GetOccupancy( side );
+		if ( !sideAttackers ) {
+			break;
+		}
+
+		const PieceType piece = PopLeastValuableAttacker( *this, toSquare, sideAttackers, occupancy, attackers );
+		if ( piece == KING && ( attackers & GetOccupancy( ~side ) ) ) {
+			break;
+		}
+
+		depth++;
+		gains[depth] = SEE_VALUES[standing] - gains[depth - 1];
+		standing = piece;
+	}
+
+	for ( ; depth > 0; depth-- ) {
+		gains[depth - 1] = -std::max( -gains[depth - 1], gains[depth] );
+	}
+
+	return gains[0];
+}
+
+bool Board::SeeGe( const Move &move, const int32_t threshold ) const {
+	if ( move.IsCastle() ) {
+		return threshold <= 0;
+	}
+
+	const Square toSquare = move.GetToSquare();
+	const auto [standing, gain] = GetSeeStart( *this, move );
+
+	// Balance from the side to move's point of view, relative to the threshold, after the next capture is answered.
+	int32_t swap = gain - threshold;
+	if ( swap < 0 ) {
+		return false;
+	}
+
+	swap = SEE_VALUES[standing] - swap;
+	if ( swap <= 0 ) {
+		return true;
+	}
+
+	Bitboard occupancy = GetSeeOccupancy( *this, move );
+	Bitboard attackers = Attacks::AllAttackersToSquare( *this, toSquare, occupancy ) & occupancy;
+
+	SideToMove side = m_Side;
+	bool result = true;
+	while ( true ) {
+		side = ~side;
+		const Bitboard sideAttackers = attackers & GetOccupancy( side );
+		if ( !sideAttackers ) {
+			break;
+		}
+
+		result = !result;
+		const PieceType piece = PopLeastValuableAttacker( *this, toSquare, sideAttackers, occupancy, attackers );
+		if ( piece == KING ) {
+			// The king may only take last, otherwise the capture is illegal and the other side keeps the result.
+			return attackers & GetOccupancy( ~side ) ? !result : result;
+		}
+
+		swap = SEE_VALUES[piece] - swap;
+		if ( swap < static_cast<int32_t>(result) ) {
+			break;
+		}
+	}
+
+	return result;
+}
+
 constexpr char PIECE_ICONS[2][6]{
 	{ 'P', 'N', 'B', 'R', 'Q', 'K' },
 	{ 'p', 'n', 'b', 'r', 'q', 'k' }
@@ -0,0 +1,161 @@
+#include "KitsuneEngine/core/hash_history.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+#include "KitsuneEngine/core/zobrist_hash.h"
+#include "KitsuneEngine/core/attacks/rays.h"
+
+static constexpr uint32_t CUCKOO_SIZE = 8192;
+
+// The hash difference of a position and the one after a single piece move: both squares of the piece and the side.
+// Pawn moves are left out, they are never reversible.
+struct CuckooTable {
+	uint64_t m_Keys[CUCKOO_SIZE]{ };
+	uint8_t m_From[CUCKOO_SIZE]{ };
+	uint8_t m_To[CUCKOO_SIZE]{ };
+	uint32_t m_Count = 0;
+};
+
+static uint32_t GetFirstSlot( const uint64_t key ) {
+	return key & ( CUCKOO_SIZE - 1 );
+}
+
+static uint32_t GetSecondSlot( const uint64_t key ) {
+	return key >> 16 & ( CUCKOO_SIZE - 1 );
+}
+
+static bool IsPieceMove( const PieceType piece, const uint8_t from, const uint8_t to ) {
+	const int32_t ranks = std::abs( from / 8 - to / 8 );
+	const int32_t files = std::abs( from % 8 - to % 8 );
+	switch ( piece ) {
+		case KNIGHT: return ranks * files == 2;
+		case BISHOP: return ranks == files;
+		case ROOK: return ranks == 0 || files == 0;
+		case QUEEN: return ranks == files || ranks == 0 || files == 0;
+		case KING: return std::max( ranks, files ) == 1;
+		default: return false;
+	}
+}
+
+// Every piece move on an empty board, stored once per square pair as a move and its reverse share a key. Each key has
+// two possible slots; one taking an occupied slot evicts the key there to its other slot, until one lands in an empty
+// slot.
+static CuckooTable BuildCuckooTable() {
+	CuckooTable table;
+
+	for ( const SideToMove side : { WHITE, BLACK } ) {
+		for ( const PieceType piece : { KNIGHT, BISHOP, ROOK, QUEEN, KING } ) {
+			for ( uint8_t from = 0; from < 64; from++ ) {
+				for ( uint8_t to = from + 1; to < 64; to++ ) {
+					if ( !IsPieceMove( piece, from, to ) ) {
+						continue;
+					}
+
+					uint64_t key = SEEDS[( piece + side * 6 ) * 64 + from] ^ SEEDS[( piece + side * 6 ) * 64 + to] ^
+					               SEEDS[768];
+					uint8_t keyFrom = from;
+					uint8_t keyTo = to;
+					uint32_t slot = GetFirstSlot( key );
+					while ( true ) {
+						std::swap( table.m_Keys[slot], key );
+						std::swap( table.m_From[slot], keyFrom );
+						std::swap( table.m_To[slot], keyTo );
+						if ( key == 0 ) {
+							break;
+						}
+
+						slot = slot == GetFirstSlot( key ) ? GetSecondSlot( key ) : GetFirstSlot( key );
+					}
+
+					table.m_Count++;
+				}
+			}
+		}
+	}
+
+	return table;
+}
+
+static const CuckooTable s_Cuckoo = BuildCuckooTable();
+
+bool HashHistory::IsRepetition( const uint8_t halfMoves, const uint16_t ply ) const {
+	const uint64_t hash = m_Hashes[m_Size - 1];
+	const uint16_t end = std::min<uint16_t>( halfMoves, m_Size - 1 );
+
+	// The same side must be to move, and it takes at least four plies to get back.
+	bool repeatedBeforeRoot = false;
+	for ( uint16_t distance = 4; distance <= end; distance += 2 ) {
+		if ( m_Hashes[m_Size - 1 - distance] != hash ) {
+			continue;
+		}
+
+		if ( distance < ply || repeatedBeforeRoot ) {
+			return true;
+		}
+
+		repeatedBeforeRoot = true;
+	}
+
+	return false;
+}
+
+// Walks back over the positions with the opponent to move, i.e. where the side to move has just made a move. Once
+// the opponent's moves since then cancel out, the two positions differ by one move of the side to move, which the
+// cuckoo table recognises from the hash difference alone.
+bool HashHistory::HasUpcomingRepetition( const Board &board, const uint16_t ply ) const {
+	const uint16_t end = std::min<uint16_t>( board.GetHalfMoves(), m_Size - 1 );
+	if ( end < 3 ) {
+		return false;
+	}
+
+	const uint64_t hash = m_Hashes[m_Size - 1];
+	uint64_t opponentMoves = hash ^ m_Hashes[m_Size - 2] ^ SEEDS[768];
+
+	for ( uint16_t distance = 3; distance <= end; distance += 2 ) {
+		opponentMoves ^= m_Hashes[m_Size - distance] ^ m_Hashes[m_Size - 1 - distance] ^ SEEDS[768];
+		if ( opponentMoves != 0 ) {
+			continue;
+		}
+
+		const uint64_t moveKey = hash ^ m_Hashes[m_Size - 1 - distance];
+		uint32_t slot = GetFirstSlot( moveKey );
+		if ( s_Cuckoo.m_Keys[slot] != moveKey ) {
+			slot = GetSecondSlot( moveKey );
+			if ( s_Cuckoo.m_Keys[slot] != moveKey ) {
+				continue;
+			}
+		}
+
+		const Square from = s_Cuckoo.m_From[slot];
+		const Square to = s_Cuckoo.m_To[slot];
+		if ( Rays::GetRayExcludeDestination( from, to ) & board.GetOccupancy() ) {
+			continue;
+		}
+
+		// A move and its reverse share the entry, the piece stands on one of the squares.
+		const Square pieceSquare = board.GetOccupancy().GetBit( from ) ? from : to;
+		if ( board.GetPieceColorOnSquare( pieceSquare ) != board.GetSideToMove() ) {
+			continue;
+		}
+
+		if ( distance < ply ) {
+			return true;
+		}
+
+		// Going back to a position before the root only draws if that position already repeated.
+		const uint64_t target = m_Hashes[m_Size - 1 - distance];
+		for ( uint16_t earlier = distance + 4; earlier <= end; earlier += 2 ) {
+			if ( m_Hashes[m_Size - 1 - earlier] == target ) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+uint32_t HashHistory::GetCuckooMoveCount() {
+	return s_Cuckoo.m_Count;
+}
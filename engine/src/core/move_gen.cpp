@@ -1,5 +1,7 @@
 #include "KitsuneEngine/core/move_gen.h"
 
+#include <algorithm>
+
 #include "KitsuneEngine/core/board.h"
 #include "KitsuneEngine/core/attacks/attacks.h"
 #include "KitsuneEngine/core/attacks/pin_mask.h"
@@ -11,3 +13,75 @@ MoveGenerator::MoveGenerator( const Board &board, const CastleMask &castleMask )
 	  m_Checkers( m_AttackMap.GetBit( m_KingSquare ) ? Attacks::GenerateCheckersMask( m_Board ) : Bitboard( Bitboard::EMPTY ) ),
 	  m_KingMoveMap( Attacks::GetKingAttacks( m_KingSquare ) & ~m_AttackMap ) {
 }
+
+bool MoveGenerator::IsQuietMoveLegal( const Move move ) const {
+	const SideToMove side = m_Board.GetSideToMove();
+	const Square fromSquare = move.GetFromSquare();
+	const Square toSquare = move.GetToSquare();
+
+	// Castling goes through the generator's own checks, there are two moves at most.
+	if ( move.IsCastle() ) {
+		if ( m_Checkers ) {
+			return false;
+		}
+
+		Move castles[2];
+		Move *end = side == WHITE ? GetCastleMoves<WHITE>( castles ) : GetCastleMoves<BLACK>( castles );
+		return std::find( castles, end, move ) != end;
+	}
+
+	const MoveFlag flag = move.GetFlag();
+	if ( ( flag != QUIET_MOVE_FLAG && flag != DOUBLE_PUSH_FLAG ) || !m_Board.GetOccupancy( side ).GetBit( fromSquare ) ||
+	     m_Board.GetOccupancy().GetBit( toSquare ) ) {
+		return false;
+	}
+
+	const PieceType piece = m_Board.GetPieceOnSquare( fromSquare );
+	if ( piece == KING ) {
+		return flag == QUIET_MOVE_FLAG && m_KingMoveMap.GetBit( toSquare );
+	}
+
+	// Other pieces can only block a single check, and a pinned one must stay on its pin ray.
+	if ( m_Checkers && ( ( m_Checkers & ( m_Checkers - 1 ) ) ||
+	                     !Rays::GetRayExcludeDestination( m_KingSquare, m_Checkers.Ls1bSquare() ).GetBit( toSquare ) ) ) {
+		return false;
+	}
+
+	const Bitboard diagPins = m_PinMask.GetDiagonalMask();
+	const Bitboard orthoPins = m_PinMask.GetOrthographicMask();
+	const bool diagPinned = diagPins.GetBit( fromSquare );
+	const bool orthoPinned = orthoPins.GetBit( fromSquare );
+
+	if ( piece == PAWN ) {
+		const Bitboard promotionRank = side == WHITE ? Bitboard::RANK_7 : Bitboard::RANK_2;
+		const Bitboard doublePushRank = side == WHITE ? Bitboard::RANK_2 : Bitboard::RANK_7;
+		const int8_t forward = side == WHITE ? 8 : -8;
+		if ( diagPinned || ( orthoPinned && !orthoPins.GetBit( toSquare ) ) || promotionRank.GetBit( fromSquare ) ) {
+			return false;
+		}
+
+		if ( flag == QUIET_MOVE_FLAG ) {
+			return toSquare == fromSquare + forward;
+		}
+
+		return doublePushRank.GetBit( fromSquare ) && toSquare == fromSquare + 2 * forward &&
+		       !m_Board.GetOccupancy().GetBit( fromSquare + forward );
+	}
+
+	if ( flag != QUIET_MOVE_FLAG ) {
+		return false;
+	}
+
+	if ( piece == KNIGHT ) {
+		return !diagPinned && !orthoPinned && Attacks::GetKnightAttacks( fromSquare ).GetBit( toSquare );
+	}
+
+	const Bitboard occupancy = m_Board.GetOccupancy();
+	const bool diagonalMove = ( piece == BISHOP || piece == QUEEN ) && !orthoPinned &&
+	                          ( !diagPinned || diagPins.GetBit( toSquare ) ) &&
+	                          Attacks::GetBishopAttacks( fromSquare, occupancy ).GetBit( toSquare );
+	const bool straightMove = ( piece == ROOK || piece == QUEEN ) && !diagPinned &&
+	                          ( !orthoPinned || orthoPins.GetBit( toSquare ) ) &&
+	                          Attacks::GetRookAttacks( fromSquare, occupancy ).GetBit( toSquare );
+	return diagonalMove || straightMove;
+}
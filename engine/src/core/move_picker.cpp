@@ -0,0 +1,160 @@
+#include "KitsuneEngine/core/move_picker.h"
+
+#include <utility>
+
+#include "KitsuneEngine/core/attacks/attacks.h"
+
+MovePicker::MovePicker( const Board &board, const CastleMask &castleMask, const Move hashMove, const bool skipQuiets )
+	: m_Board( board ), m_Generator( board, castleMask ), m_HashMove( hashMove ), m_SkipQuiets( skipQuiets ) {
+}
+
+Move MovePicker::Next() {
+	switch ( m_Stage ) {
+		case MovePickerStage::HASH_MOVE:
+			m_Stage = MovePickerStage::GENERATE_NOISY;
+			if ( IsHashMoveLegal() ) {
+				return m_HashMove;
+			}
+			[[fallthrough]];
+		case MovePickerStage::GENERATE_NOISY:
+			GenerateNoisy();
+			m_Stage = MovePickerStage::NOISY;
+			[[fallthrough]];
+		case MovePickerStage::NOISY:
+			// SEE only runs on moves about to be played, a cutoff before them saves the rest.
+			while ( const Move move = SelectNext( m_NoisyMoves, m_NoisyScores, m_NoisyCount, m_NoisyIndex ) ) {
+				if ( m_Board.SeeGe( move, 0 ) ) {
+					return move;
+				}
+
+				m_BadNoisyMoves[m_BadNoisyCount++] = move;
+			}
+
+			if ( m_SkipQuiets ) {
+				m_Stage = MovePickerStage::DONE;
+				return Move();
+			}
+
+			m_Stage = MovePickerStage::GENERATE_QUIET;
+			[[fallthrough]];
+		case MovePickerStage::GENERATE_QUIET:
+			GenerateQuiets();
+			m_Stage = MovePickerStage::QUIET;
+			[[fallthrough]];
+		case MovePickerStage::QUIET:
+			if ( const Move move = SelectNext( m_QuietMoves, m_QuietScores, m_QuietCount, m_QuietIndex ) ) {
+				return move;
+			}
+
+			m_Stage = MovePickerStage::BAD_NOISY;
+			[[fallthrough]];
+		case MovePickerStage::BAD_NOISY:
+			if ( m_BadNoisyIndex < m_BadNoisyCount ) {
+				return m_BadNoisyMoves[m_BadNoisyIndex++];
+			}
+
+			m_Stage = MovePickerStage::DONE;
+			[[fallthrough]];
+		case MovePickerStage::DONE:
+			return Move();
+	}
+
+	return Move();
+}
+
+int16_t MovePicker::ScoreNoisy( const Board &board, const Move move ) {
+	const PieceType attacker = board.GetPieceOnSquare( move.GetFromSquare() );
+	PieceType victim = NULL_PIECE;
+	if ( move.IsEnPassant() ) {
+		victim = PAWN;
+	} else if ( move.IsCapture() ) {
+		victim = board.GetPieceOnSquare( move.GetToSquare() );
+	}
+
+	auto score = static_cast<int16_t>(SEE_VALUES[victim] * 8 - attacker);
+	if ( move.IsPromotion() ) {
+		score += static_cast<int16_t>(move.GetPromotionPieceType() == QUEEN ? SEE_VALUES[QUEEN] : -SEE_VALUES[QUEEN]);
+	}
+
+	return score;
+}
+
+// No history yet: quiets only avoid stepping onto squares covered by an enemy pawn.
+int16_t MovePicker::ScoreQuiet( const Board &board, const Move move ) {
+	const SideToMove side = board.GetSideToMove();
+	const PieceType piece = board.GetPieceOnSquare( move.GetFromSquare() );
+	const Bitboard enemyPawns = board.GetPieceMask( PAWN, ~side );
+
+	if ( piece != PAWN && !move.IsCastle() && ( Attacks::GetPawnAttacks( move.GetToSquare(), side ) & enemyPawns ) ) {
+		return static_cast<int16_t>(-SEE_VALUES[piece]);
+	}
+
+	return 0;
+}
+
+void MovePicker::GenerateNoisy() {
+	if ( m_NoisyGenerated ) {
+		return;
+	}
+
+	m_NoisyCount = m_Generator.GenerateMoves<MoveGenMode::NOISY>( m_NoisyMoves );
+	for ( uint8_t i = 0; i < m_NoisyCount; i++ ) {
+		m_NoisyScores[i] = ScoreNoisy( m_Board, m_NoisyMoves[i] );
+	}
+
+	m_NoisyGenerated = true;
+}
+
+void MovePicker::GenerateQuiets() {
+	if ( m_QuietGenerated ) {
+		return;
+	}
+
+	m_QuietCount = m_Generator.GenerateMoves<MoveGenMode::QUIET>( m_QuietMoves );
+	for ( uint8_t i = 0; i < m_QuietCount; i++ ) {
+		m_QuietScores[i] = ScoreQuiet( m_Board, m_QuietMoves[i] );
+	}
+
+	m_QuietGenerated = true;
+}
+
+// A hash move can come from a colliding entry, so it has to be checked first. Noisy moves are generated right after
+// anyway, so a noisy one is looked up in that list; a quiet one is checked on its own, keeping quiets for their stage.
+bool MovePicker::IsHashMoveLegal() {
+	if ( !m_HashMove ) {
+		return false;
+	}
+
+	if ( !m_HashMove.IsCapture() && !m_HashMove.IsPromotion() ) {
+		return !m_SkipQuiets && m_Generator.IsQuietMoveLegal( m_HashMove );
+	}
+
+	GenerateNoisy();
+	for ( uint8_t i = 0; i < m_NoisyCount; i++ ) {
+		if ( m_NoisyMoves[i] == m_HashMove ) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+Move MovePicker::SelectNext( Move *moves, int16_t *scores, const uint8_t count, uint8_t &index ) const {
+	while ( index < count ) {
+		uint8_t best = index;
+		for ( uint8_t i = index + 1; i < count; i++ ) {
+			if ( scores[i] > scores[best] ) {
+				best = i;
+			}
+		}
+
+		std::swap( moves[index], moves[best] );
+		std::swap( scores[index], scores[best] );
+
+		if ( const Move move = moves[index++]; move != m_HashMove ) {
+			return move;
+		}
+	}
+
+	return Move();
+}
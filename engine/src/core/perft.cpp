@@ -1,10 +1,71 @@
 #include "KitsuneEngine/core/perft.h"
 
+#include <atomic>
 #include <format>
 
+#include "KitsuneEngine/thread_pool.h"
 #include "KitsuneEngine/core/move.h"
 #include "KitsuneEngine/core/board.h"
 #include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/core/perft_hash_table.h"
+#include "KitsuneEngine/core/undo_stack.h"
+
+// Copy-make trades a Board copy per move against make/unmake's undo bookkeeping. Which one wins depends on the
+// compiler and CPU, so it is picked per build with the KITSUNE_COPY_MAKE CMake option, make/unmake by default. The
+// perft benchmark in Kitsune-Bench measures both.
+#if COPY_MAKE
+static constexpr bool USE_COPY_MAKE = true;
+#else
+static constexpr bool USE_COPY_MAKE = false;
+#endif
+
+// Depth 1 nodes are cheaper to generate than to look up.
+static constexpr uint8_t HASH_MIN_DEPTH = 2;
+
+// Subtrees at or below this depth are walked serially by a single task, deeper ones are split into child tasks.
+static constexpr uint8_t PARALLEL_SPLIT_DEPTH = 4;
+
+template<bool COPY, typename Function>
+static uint64_t VisitChild( Board &board, const CastleMask &castleMask, const Move &move, UndoStack &undoStack,
+                            const Function &visit ) {
+	if constexpr ( COPY ) {
+		Board child = board;
+		child.MakeMove( move, castleMask );
+		return visit( child );
+	} else {
+		board.MakeMove( move, castleMask, undoStack.Push() );
+		const uint64_t result = visit( board );
+		board.UnmakeMove( move, undoStack.Pop() );
+		return result;
+	}
+}
+
+template<bool COPY>
+static uint64_t Perft_Internal( Board &board, const CastleMask &castleMask, const uint8_t depth, const bool bulk,
+                                UndoStack &undoStack ) {
+	if ( depth == 0 ) {
+		return 1;
+	}
+
+	const auto moveGenerator = MoveGenerator( board, castleMask );
+
+	if ( depth == 1 && bulk ) {
+		return moveGenerator.CountMoves<MoveGenMode::ALL>();
+	}
+
+	Move moves[MAX_MOVES]{ };
+	const uint8_t movesCount = moveGenerator.GenerateMoves<MoveGenMode::ALL>( moves );
+
+	uint64_t result = 0;
+
+	for ( uint8_t i = 0; i < movesCount; ++i ) {
+		result += VisitChild<COPY>( board, castleMask, moves[i], undoStack, [&]( Board &child ) {
+			return Perft_Internal<COPY>( child, castleMask, depth - 1, bulk, undoStack );
+		} );
+	}
+
+	return result;
+}
 
 uint64_t Perft( const Board &board, const CastleMask &castleMask, const uint8_t depth, const bool bulk, const bool printSplit,
                 const bool isFirst ) {
@@ -12,27 +73,191 @@ uint64_t Perft( const Board &board, const CastleMask &castleMask, const uint8_t
 		return 1;
 	}
 
+	Board root = board;
+	UndoStack undoStack;
+
+	if ( !printSplit || !isFirst ) {
+		return Perft_Internal<USE_COPY_MAKE>( root, castleMask, depth, bulk, undoStack );
+	}
+
 	Move moves[MAX_MOVES]{ };
-	uint8_t movesCount = 0;
 	const auto moveGenerator = MoveGenerator( board, castleMask );
-	movesCount = moveGenerator.GenerateMoves<MoveGenMode::ALL>( moves );
+	const uint8_t movesCount = moveGenerator.GenerateMoves<MoveGenMode::ALL>( moves );
+
+	uint64_t result = 0;
+
+	for ( uint8_t i = 0; i < movesCount; ++i ) {
+		const uint64_t split = VisitChild<USE_COPY_MAKE>( root, castleMask, moves[i], undoStack, [&]( Board &child ) {
+			return Perft_Internal<USE_COPY_MAKE>( child, castleMask, depth - 1, bulk, undoStack );
+		} );
+
+		result += split;
+
+		printf( std::format( "{} - {}\n", moves[i].ToString( board.GetChess960() ), split ).c_str() );
+	}
+
+	return result;
+}
+
+uint64_t PerftCopyMake( const Board &board, const CastleMask &castleMask, const uint8_t depth, const bool bulk ) {
+	Board root = board;
+	UndoStack undoStack;
+	return Perft_Internal<true>( root, castleMask, depth, bulk, undoStack );
+}
+
+uint64_t PerftMakeUnmake( const Board &board, const CastleMask &castleMask, const uint8_t depth, const bool bulk ) {
+	Board root = board;
+	UndoStack undoStack;
+	return Perft_Internal<false>( root, castleMask, depth, bulk, undoStack );
+}
+
+// The position hash does not cover which rooks the castle rights refer to, which only matters in Chess960 when both
+// rooks stand on the same side of the king. Salting the key with the root's rook squares lets roots share one table.
+static uint64_t GetRookSalt( const Board &board ) {
+	uint64_t salt = 0;
+	for ( uint8_t i = 0; i < 4; i++ ) {
+		salt = salt * 65 + board.GetRookSquare( i );
+	}
+
+	return salt * 0xD6E8FEB86659FD93ull;
+}
+
+static uint64_t HashedPerft_Internal( Board &board, const CastleMask &castleMask, const uint8_t depth, const bool bulk,
+                                      const uint64_t salt, PerftHashTable &table, PerftHashStats &stats,
+                                      UndoStack &undoStack ) {
+	if ( depth == 0 ) {
+		return 1;
+	}
+
+	const uint64_t key = board.GetHash() ^ salt;
+	if ( uint64_t nodes = 0; depth >= HASH_MIN_DEPTH && table.Probe( key, depth, nodes, stats ) ) {
+		return nodes;
+	}
+
+	const auto moveGenerator = MoveGenerator( board, castleMask );
 
 	if ( depth == 1 && bulk ) {
-		return movesCount;
+		return moveGenerator.CountMoves<MoveGenMode::ALL>();
 	}
 
+	Move moves[MAX_MOVES]{ };
+	const uint8_t movesCount = moveGenerator.GenerateMoves<MoveGenMode::ALL>( moves );
+
+	uint64_t result = 0;
+
+	for ( uint8_t i = 0; i < movesCount; ++i ) {
+		result += VisitChild<USE_COPY_MAKE>( board, castleMask, moves[i], undoStack, [&]( Board &child ) {
+			return HashedPerft_Internal( child, castleMask, depth - 1, bulk, salt, table, stats, undoStack );
+		} );
+	}
+
+	if ( depth >= HASH_MIN_DEPTH ) {
+		table.Store( key, depth, result, stats );
+	}
+
+	return result;
+}
+
+uint64_t HashedPerft( const Board &board, const CastleMask &castleMask, const uint8_t depth, const bool bulk,
+                      const bool printSplit, PerftHashTable &table ) {
+	if ( depth == 0 ) {
+		return 1;
+	}
+
+	const uint64_t salt = GetRookSalt( board );
+	PerftHashStats stats{ };
+	Board root = board;
+	UndoStack undoStack;
+
+	Move moves[MAX_MOVES]{ };
+	const auto moveGenerator = MoveGenerator( board, castleMask );
+	const uint8_t movesCount = moveGenerator.GenerateMoves<MoveGenMode::ALL>( moves );
+
 	uint64_t result = 0;
 
+	for ( uint8_t i = 0; i < movesCount; ++i ) {
+		const uint64_t split = VisitChild<USE_COPY_MAKE>( root, castleMask, moves[i], undoStack, [&]( Board &child ) {
+			return HashedPerft_Internal( child, castleMask, depth - 1, bulk, salt, table, stats, undoStack );
+		} );
+
+		result += split;
+
+		if ( printSplit ) {
+			printf( std::format( "{} - {}\n", moves[i].ToString( board.GetChess960() ), split ).c_str() );
+		}
+	}
+
+	table.MergeStats( stats );
+	return result;
+}
+
+static void SplitPerftTask( ThreadPool &pool, const Board &board, const CastleMask &castleMask, const uint8_t depth,
+                            const bool bulk, const uint64_t salt, PerftHashTable *table, std::atomic<uint64_t> &result ) {
+	if ( depth <= PARALLEL_SPLIT_DEPTH ) {
+		Board root = board;
+		UndoStack undoStack;
+		uint64_t nodes;
+
+		if ( table ) {
+			PerftHashStats stats{ };
+			nodes = HashedPerft_Internal( root, castleMask, depth, bulk, salt, *table, stats, undoStack );
+			table->MergeStats( stats );
+		} else {
+			nodes = Perft_Internal<USE_COPY_MAKE>( root, castleMask, depth, bulk, undoStack );
+		}
+
+		result.fetch_add( nodes, std::memory_order_relaxed );
+		return;
+	}
+
+	Move moves[MAX_MOVES]{ };
+	const auto moveGenerator = MoveGenerator( board, castleMask );
+	const uint8_t movesCount = moveGenerator.GenerateMoves<MoveGenMode::ALL>( moves );
+
 	for ( uint8_t i = 0; i < movesCount; ++i ) {
 		Board newBoard = board;
-		Move move = moves[i];
-		newBoard.MakeMove( move, castleMask );
-		const uint64_t split = Perft( newBoard, castleMask, depth - 1, bulk, printSplit, false );
+		newBoard.MakeMove( moves[i], castleMask );
+		pool.Submit( [&pool, newBoard, &castleMask, depth, bulk, salt, table, &result] {
+			SplitPerftTask( pool, newBoard, castleMask, depth - 1, bulk, salt, table, result );
+		} );
+	}
+}
 
+uint64_t ParallelPerft( const Board &board, const CastleMask &castleMask, const uint8_t depth, const bool bulk,
+                        const bool printSplit, const uint32_t threadCount, PerftHashTable *table ) {
+	if ( depth == 0 ) {
+		return 1;
+	}
+
+	Move moves[MAX_MOVES]{ };
+	const auto moveGenerator = MoveGenerator( board, castleMask );
+	const uint8_t movesCount = moveGenerator.GenerateMoves<MoveGenMode::ALL>( moves );
+
+	std::atomic<uint64_t> splits[MAX_MOVES]{ };
+	const uint64_t salt = GetRookSalt( board );
+
+	{
+		ThreadPool pool( threadCount );
+
+		for ( uint8_t i = 0; i < movesCount; ++i ) {
+			Board newBoard = board;
+			newBoard.MakeMove( moves[i], castleMask );
+			pool.Submit( [&pool, newBoard, &castleMask, depth, bulk, salt, table, &split = splits[i]] {
+				SplitPerftTask( pool, newBoard, castleMask, depth - 1, bulk, salt, table, split );
+			} );
+		}
+
+		pool.Wait();
+	}
+
+	uint64_t result = 0;
+
+	for ( uint8_t i = 0; i < movesCount; ++i ) {
+		const uint64_t split = splits[i].load();
 		result += split;
 
-		if ( printSplit && isFirst ) {
-			printf( std::format( "{} - {}\n", move.ToString( board.GetChess960() ), split ).c_str() );
+		if ( printSplit ) {
+			printf( std::format( "{} - {}\n", moves[i].ToString( board.GetChess960() ), split ).c_str() );
 		}
 	}
 
@@ -0,0 +1,93 @@
+#include "KitsuneEngine/core/perft_hash_table.h"
+
+#include <algorithm>
+#include <bit>
+#include <format>
+
+static constexpr uint64_t DEPTH_MASK = 0xFF;
+
+PerftHashTable::PerftHashTable( const uint32_t megabytes ) {
+	Resize( megabytes );
+}
+
+void PerftHashTable::Resize( const uint32_t megabytes ) {
+	const uint64_t bytes = static_cast<uint64_t>(megabytes) * 1024 * 1024;
+	m_BucketCount = std::bit_floor( std::max<uint64_t>( bytes / sizeof( Bucket ), 1 ) );
+	m_Buckets = std::make_unique<Bucket[]>( m_BucketCount );
+	Clear();
+}
+
+void PerftHashTable::Clear() {
+	for ( uint64_t i = 0; i < m_BucketCount; i++ ) {
+		for ( Entry &entry : m_Buckets[i].m_Entries ) {
+			entry.m_Key.store( 0, std::memory_order_relaxed );
+			entry.m_Data.store( 0, std::memory_order_relaxed );
+		}
+	}
+
+	m_Probes = 0;
+	m_Hits = 0;
+	m_Collisions = 0;
+	m_Stores = 0;
+}
+
+bool PerftHashTable::Probe( const uint64_t hash, const uint8_t depth, uint64_t &nodes, PerftHashStats &stats ) const {
+	const uint64_t key = MixDepth( hash, depth );
+	const Bucket &bucket = m_Buckets[GetIndex( key )];
+
+	stats.m_Probes++;
+
+	bool occupied = false;
+	for ( const Entry &entry : bucket.m_Entries ) {
+		const uint64_t data = entry.m_Data.load( std::memory_order_relaxed );
+		const uint64_t storedKey = entry.m_Key.load( std::memory_order_relaxed );
+
+		if ( ( storedKey ^ data ) == key && ( data & DEPTH_MASK ) == depth ) {
+			nodes = data >> 8;
+			stats.m_Hits++;
+			return true;
+		}
+
+		occupied |= data != 0;
+	}
+
+	if ( occupied ) {
+		stats.m_Collisions++;
+	}
+
+	return false;
+}
+
+void PerftHashTable::Store( const uint64_t hash, const uint8_t depth, const uint64_t nodes, PerftHashStats &stats ) {
+	const uint64_t key = MixDepth( hash, depth );
+	Bucket &bucket = m_Buckets[GetIndex( key )];
+	const uint64_t data = nodes << 8 | depth;
+
+	Entry &deepest = bucket.m_Entries[0];
+	const uint64_t deepestData = deepest.m_Data.load( std::memory_order_relaxed );
+	Entry &target = ( deepestData & DEPTH_MASK ) <= depth ? deepest : bucket.m_Entries[1];
+
+	target.m_Data.store( data, std::memory_order_relaxed );
+	target.m_Key.store( key ^ data, std::memory_order_relaxed );
+
+	stats.m_Stores++;
+}
+
+void PerftHashTable::MergeStats( const PerftHashStats &stats ) {
+	m_Probes.fetch_add( stats.m_Probes, std::memory_order_relaxed );
+	m_Hits.fetch_add( stats.m_Hits, std::memory_order_relaxed );
+	m_Collisions.fetch_add( stats.m_Collisions, std::memory_order_relaxed );
+	m_Stores.fetch_add( stats.m_Stores, std::memory_order_relaxed );
+}
+
+PerftHashStats PerftHashTable::GetStats() const {
+	return PerftHashStats{ m_Probes.load(), m_Hits.load(), m_Collisions.load(), m_Stores.load() };
+}
+
+std::string PerftHashTable::ToString() const {
+	const PerftHashStats stats = GetStats();
+	const double hitRate = stats.m_Probes ? 100.0 * stats.m_Hits / stats.m_Probes : 0.0;
+	return std::format( "Hash: {} MB, Probes: {}, Hits: {} ({:.2f}%), Collisions: {}, Stores: {}",
+	                    GetSizeInBytes() / ( 1024 * 1024 ), stats.m_Probes, stats.m_Hits, hitRate, stats.m_Collisions,
+	                    stats.m_Stores );
+}
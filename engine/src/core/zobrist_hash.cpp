@@ -155,5 +155,7 @@ extern const uint64_t SEEDS[793]{
 	0x90905e5263ca4b5, 0x3c287b776bc9adfc, 0x69c7d9550d59d33b, 0x3ae12a6e3ab1836e, 0x43ff70bc1555806a,
 	0x4a24f795b3c3df48, 0x80888df8ef88f0c0, 0x276495582e21f0a0, 0xda438d5353b79088, 0x115cb5ee67f6eff4,
 	0xa3d12e8907b4c243, 0x5bb434dea5587100, 0x41d0b9bf547c7165, 0x263cb5b3aaac4024, 0x64419a565a4c6030,
-	0xb8e4b8d5e7ba448c, 0x976e66417f80eee7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xb8e4b8d5e7ba448c, 0x976e66417f80eee7, 0xabfd95d1eae1749d, 0xcd6cb1e661563ab6, 0xe3c8e7c32c03b4e8,
+	0x8fd6ce3442f89663, 0xafff0b94508c050e, 0x8a7e6c961abe966d, 0xa7f65940e6c7d133, 0x284438a3bf5cbf4f,
+	0xd10b9db8e28ffce7, 0x163eeaa06e001ccf, 0xb9a29e75ae7085a9, 0xc676b1ec171a7a83,
 };
\ No newline at end of file
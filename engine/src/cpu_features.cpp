@@ -0,0 +1,102 @@
+#include "KitsuneEngine/cpu_features.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+static constexpr uint32_t CPUID_BMI2_BIT = 1 << 8;
+static constexpr uint32_t CPUID_AVX2_BIT = 1 << 5;
+static constexpr uint32_t CPUID_AVX512F_BIT = 1 << 16;
+static constexpr uint32_t CPUID_AVX512BW_BIT = 1 << 30;
+static constexpr uint32_t CPUID_OSXSAVE_BIT = 1 << 27;
+
+// XCR0 bits for the SSE and AVX state, and for the AVX-512 opmask and upper register state.
+static constexpr uint64_t XCR0_AVX_STATE = 0x6;
+static constexpr uint64_t XCR0_AVX512_STATE = 0xE6;
+static constexpr uint32_t AMD_ZEN3_FAMILY = 0x19;
+
+static void Cpuid( const uint32_t leaf, const uint32_t subLeaf, uint32_t registers[4] ) {
+#if defined(_MSC_VER)
+	int values[4];
+	__cpuidex( values, static_cast<int>(leaf), static_cast<int>(subLeaf) );
+	for ( int i = 0; i < 4; i++ ) {
+		registers[i] = static_cast<uint32_t>(values[i]);
+	}
+#else
+	__cpuid_count( leaf, subLeaf, registers[0], registers[1], registers[2], registers[3] );
+#endif
+}
+
+static uint64_t ReadXcr0() {
+	uint32_t registers[4];
+	Cpuid( 1, 0, registers );
+	if ( !( registers[2] & CPUID_OSXSAVE_BIT ) ) {
+		return 0;
+	}
+
+#if defined(_MSC_VER)
+	return _xgetbv( 0 );
+#else
+	uint32_t low, high;
+	asm volatile( "xgetbv" : "=a"( low ), "=d"( high ) : "c"( 0 ) );
+	return static_cast<uint64_t>(high) << 32 | low;
+#endif
+}
+
+static uint32_t GetExtendedFeatures() {
+	uint32_t registers[4];
+	Cpuid( 0, 0, registers );
+
+	if ( registers[0] < 7 ) {
+		return 0;
+	}
+
+	Cpuid( 7, 0, registers );
+	return registers[1];
+}
+
+static uint32_t GetFamily() {
+	uint32_t registers[4];
+	Cpuid( 1, 0, registers );
+
+	const uint32_t baseFamily = ( registers[0] >> 8 ) & 0xF;
+	return baseFamily == 0xF ? baseFamily + ( ( registers[0] >> 20 ) & 0xFF ) : baseFamily;
+}
+
+bool CpuFeatures::HasBmi2() {
+	return GetExtendedFeatures() & CPUID_BMI2_BIT;
+}
+
+bool CpuFeatures::HasFastPext() {
+	if ( !HasBmi2() ) {
+		return false;
+	}
+
+	return GetVendor() != "AuthenticAMD" || GetFamily() >= AMD_ZEN3_FAMILY;
+}
+
+bool CpuFeatures::HasAvx2() {
+	return ( GetExtendedFeatures() & CPUID_AVX2_BIT ) && ( ReadXcr0() & XCR0_AVX_STATE ) == XCR0_AVX_STATE;
+}
+
+bool CpuFeatures::HasAvx512() {
+	const uint32_t features = GetExtendedFeatures();
+	return ( features & CPUID_AVX512F_BIT ) && ( features & CPUID_AVX512BW_BIT ) &&
+	       ( ReadXcr0() & XCR0_AVX512_STATE ) == XCR0_AVX512_STATE;
+}
+
+std::string CpuFeatures::GetVendor() {
+	uint32_t registers[4];
+	Cpuid( 0, 0, registers );
+
+	char vendor[13]{ };
+	std::memcpy( vendor, &registers[1], 4 );
+	std::memcpy( vendor + 4, &registers[3], 4 );
+	std::memcpy( vendor + 8, &registers[2], 4 );
+	return vendor;
+}
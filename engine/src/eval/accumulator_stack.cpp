@@ -0,0 +1,129 @@
+#include "KitsuneEngine/eval/accumulator_stack.h"
+
+#include <algorithm>
+
+void AccumulatorStack::Reset() {
+	for ( auto &perspectiveEntries : m_FinnyTable ) {
+		for ( FinnyEntry &entry : perspectiveEntries ) {
+			std::copy_n( Nnue::GetFeatureBiases(), NNUE_HIDDEN_SIZE, entry.m_Values );
+			for ( auto &pieces : entry.m_Pieces ) {
+				std::ranges::fill( pieces, Bitboard( 0 ) );
+			}
+		}
+	}
+
+	m_Size = 0;
+	static_cast<void>(Push());
+	m_Stats = { };
+}
+
+int32_t AccumulatorStack::Evaluate( const Board &board ) {
+	Update( board, WHITE );
+	Update( board, BLACK );
+	return Nnue::Evaluate( m_Entries[m_Size - 1].m_Accumulator, board.GetSideToMove() );
+}
+
+void AccumulatorStack::Update( const Board &board, const SideToMove perspective ) {
+	const uint16_t top = m_Size - 1;
+	if ( m_Entries[top].m_Computed[perspective] ) {
+		return;
+	}
+
+	// Walk down to the nearest computed ply, or to the ply where this side's king changed bucket. Every ply above it
+	// shares the current king bucket, so the current king square gives the right feature indices for all of them.
+	uint16_t base = top;
+	while ( !m_Entries[base].m_Computed[perspective] && base > 0 &&
+	        !IsKingBucketChanged( m_Entries[base].m_DirtyPieces, perspective ) ) {
+		base--;
+	}
+
+	const Square kingSquare = board.GetKingSquare( perspective );
+	if ( m_Entries[base].m_Computed[perspective] ) {
+		for ( uint16_t ply = base + 1; ply <= top; ply++ ) {
+			ApplyDelta( ply, perspective, kingSquare, false );
+		}
+		return;
+	}
+
+	// Otherwise refresh the top and fill in the plies below it by undoing their deltas, so the rest of this subtree
+	// chains from them instead of refreshing again.
+	RefreshFromFinnyTable( board, perspective, m_Entries[top].m_Accumulator.m_Values[perspective] );
+	m_Entries[top].m_Computed[perspective] = true;
+	for ( uint16_t ply = top; ply > base; ply-- ) {
+		ApplyDelta( ply, perspective, kingSquare, true );
+	}
+}
+
+// Forwards computes ply from ply - 1, backwards computes ply - 1 from ply.
+void AccumulatorStack::ApplyDelta( const uint16_t ply, const SideToMove perspective, const Square kingSquare,
+                                   const bool backwards ) {
+	const DirtyPieces &dirtyPieces = m_Entries[ply].m_DirtyPieces;
+
+	uint32_t added[2];
+	uint32_t removed[2];
+	for ( uint8_t i = 0; i < dirtyPieces.m_AddedCount; i++ ) {
+		const DirtyPiece &piece = dirtyPieces.m_Added[i];
+		added[i] = Nnue::GetFeatureIndex( piece.m_Piece, piece.m_Color, piece.m_Square, perspective, kingSquare );
+	}
+	for ( uint8_t i = 0; i < dirtyPieces.m_RemovedCount; i++ ) {
+		const DirtyPiece &piece = dirtyPieces.m_Removed[i];
+		removed[i] = Nnue::GetFeatureIndex( piece.m_Piece, piece.m_Color, piece.m_Square, perspective, kingSquare );
+	}
+
+	AccumulatorEntry &source = m_Entries[backwards ? ply : ply - 1];
+	AccumulatorEntry &target = m_Entries[backwards ? ply - 1 : ply];
+	if ( backwards ) {
+		Nnue::UpdateRow( source.m_Accumulator.m_Values[perspective], target.m_Accumulator.m_Values[perspective], removed,
+		                 dirtyPieces.m_RemovedCount, added, dirtyPieces.m_AddedCount );
+	} else {
+		Nnue::UpdateRow( source.m_Accumulator.m_Values[perspective], target.m_Accumulator.m_Values[perspective], added,
+		                 dirtyPieces.m_AddedCount, removed, dirtyPieces.m_RemovedCount );
+	}
+
+	target.m_Computed[perspective] = true;
+	m_Stats.m_AppliedRows += dirtyPieces.m_AddedCount + dirtyPieces.m_RemovedCount;
+}
+
+void AccumulatorStack::RefreshFromFinnyTable( const Board &board, const SideToMove perspective, int16_t *values ) {
+	const Square kingSquare = board.GetKingSquare( perspective );
+	FinnyEntry &entry = m_FinnyTable[perspective][Nnue::GetKingBucketIndex( kingSquare, perspective )];
+
+	uint32_t added[32];
+	uint32_t removed[32];
+	uint32_t addedCount = 0;
+	uint32_t removedCount = 0;
+
+	for ( const SideToMove side : { WHITE, BLACK } ) {
+		for ( int piece = PAWN; piece <= KING; piece++ ) {
+			const auto pieceType = static_cast<PieceType>(piece);
+			const Bitboard current = board.GetPieceMask( pieceType, side );
+			const Bitboard cached = entry.m_Pieces[side][piece];
+
+			( current & ~cached ).Map( [&]( const Square square ) {
+				added[addedCount++] = Nnue::GetFeatureIndex( pieceType, side, square, perspective, kingSquare );
+			} );
+			( cached & ~current ).Map( [&]( const Square square ) {
+				removed[removedCount++] = Nnue::GetFeatureIndex( pieceType, side, square, perspective, kingSquare );
+			} );
+
+			entry.m_Pieces[side][piece] = current;
+		}
+	}
+
+	Nnue::UpdateRow( entry.m_Values, entry.m_Values, added, addedCount, removed, removedCount );
+	std::copy_n( entry.m_Values, NNUE_HIDDEN_SIZE, values );
+
+	m_Stats.m_AppliedRows += addedCount + removedCount;
+	m_Stats.m_Refreshes++;
+}
+
+// The mover is always the first removed piece and, for a king, its destination the first added one.
+bool AccumulatorStack::IsKingBucketChanged( const DirtyPieces &dirtyPieces, const SideToMove perspective ) {
+	const DirtyPiece &moved = dirtyPieces.m_Removed[0];
+	if ( moved.m_Piece != KING || moved.m_Color != perspective ) {
+		return false;
+	}
+
+	return Nnue::GetKingBucketIndex( moved.m_Square, perspective ) !=
+	       Nnue::GetKingBucketIndex( dirtyPieces.m_Added[0].m_Square, perspective );
+}
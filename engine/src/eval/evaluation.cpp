@@ -0,0 +1,83 @@
+#include "KitsuneEngine/eval/evaluation.h"
+
+#include <algorithm>
+
+#include "KitsuneEngine/core/board.h"
+
+// Untuned starting values. Passed pawns are indexed by rank relative to their side.
+static constexpr PackedScore PASSED_PAWN_BONUS[8]{
+	PackScore( 0, 0 ), PackScore( -2, 8 ), PackScore( -5, 12 ), PackScore( 5, 20 ),
+	PackScore( 15, 35 ), PackScore( 30, 65 ), PackScore( 50, 100 ), PackScore( 0, 0 ),
+};
+static constexpr PackedScore ISOLATED_PAWN_PENALTY = PackScore( -10, -12 );
+static constexpr PackedScore DOUBLED_PAWN_PENALTY = PackScore( -8, -20 );
+
+static constexpr uint64_t FillNorth( uint64_t bitboard ) {
+	bitboard |= bitboard << 8;
+	bitboard |= bitboard << 16;
+	return bitboard | bitboard << 32;
+}
+
+static constexpr uint64_t FillSouth( uint64_t bitboard ) {
+	bitboard |= bitboard >> 8;
+	bitboard |= bitboard >> 16;
+	return bitboard | bitboard >> 32;
+}
+
+static constexpr uint64_t ShiftWest( const uint64_t bitboard ) {
+	return ( bitboard & ~Bitboard::FILE_A ) >> 1;
+}
+
+static constexpr uint64_t ShiftEast( const uint64_t bitboard ) {
+	return ( bitboard & ~Bitboard::FILE_H ) << 1;
+}
+
+int32_t Evaluation::Evaluate( const Board &board ) {
+	return Evaluate( board, EvaluatePawns( board ) );
+}
+
+int32_t Evaluation::Evaluate( const Board &board, PawnHashTable &pawnTable ) {
+	return Evaluate( board, pawnTable.Probe( board ) );
+}
+
+int32_t Evaluation::Evaluate( const Board &board, const PawnEntry &pawns ) {
+	const PackedScore score = board.GetPsqtScore() + pawns.m_Score;
+	const int32_t phase = std::min<int32_t>( board.GetPhase(), MAX_PHASE );
+	const int32_t result = ( GetMiddlegameScore( score ) * phase + GetEndgameScore( score ) * ( MAX_PHASE - phase ) ) /
+	                       MAX_PHASE;
+
+	return board.GetSideToMove() == WHITE ? result : -result;
+}
+
+PawnEntry Evaluation::EvaluatePawns( const Board &board ) {
+	PawnEntry entry;
+	entry.m_Key = board.GetPawnHash();
+
+	const uint64_t pawns[2]{ board.GetPieceMask( PAWN, WHITE ), board.GetPieceMask( PAWN, BLACK ) };
+
+	// Front spans are the squares ahead of a side's pawns, attack spans every square they could attack as they advance.
+	// A pawn is passed when neither span of the enemy pawns reaches it.
+	const uint64_t whiteFill = FillNorth( pawns[WHITE] );
+	const uint64_t blackFill = FillSouth( pawns[BLACK] );
+	const uint64_t frontSpans[2]{ whiteFill << 8, blackFill >> 8 };
+	entry.m_AttackSpans[WHITE] = ShiftWest( whiteFill << 8 ) | ShiftEast( whiteFill << 8 );
+	entry.m_AttackSpans[BLACK] = ShiftWest( blackFill >> 8 ) | ShiftEast( blackFill >> 8 );
+
+	for ( const SideToMove side : { WHITE, BLACK } ) {
+		const uint64_t files = FillNorth( FillSouth( pawns[side] ) );
+		const uint64_t isolated = pawns[side] & ~( ShiftWest( files ) | ShiftEast( files ) );
+		const uint64_t doubled = pawns[side] & ( side == WHITE ? FillSouth( pawns[WHITE] >> 8 )
+			                                                     : FillNorth( pawns[BLACK] << 8 ) );
+		entry.m_Passed[side] = pawns[side] & ~( frontSpans[~side] | entry.m_AttackSpans[~side] );
+
+		PackedScore score = ISOLATED_PAWN_PENALTY * static_cast<int32_t>(Bitboard( isolated ).PopCount()) +
+		                    DOUBLED_PAWN_PENALTY * static_cast<int32_t>(Bitboard( doubled ).PopCount());
+		entry.m_Passed[side].Map( [&score, side]( const Square square ) {
+			score += PASSED_PAWN_BONUS[side == WHITE ? square.GetRank() : 7 - square.GetRank()];
+		} );
+
+		entry.m_Score += side == WHITE ? score : -score;
+	}
+
+	return entry;
+}
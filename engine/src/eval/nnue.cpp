@@ -0,0 +1,251 @@
+#include "KitsuneEngine/eval/nnue.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "KitsuneEngine/cpu_features.h"
+#include "KitsuneEngine/core/board.h"
+
+// GCC and Clang only emit wider instructions inside functions that enable them, MSVC accepts the intrinsics anywhere.
+#if defined(_MSC_VER)
+#define KITSUNE_TARGET( features )
+#else
+#define KITSUNE_TARGET( features ) __attribute__(( target( features ) ))
+#endif
+
+// The output layer multiplies clipped activations by weights in int16, which only fits for weights within this range.
+static constexpr int32_t MAX_OUTPUT_WEIGHT = 32767 / NNUE_QA;
+
+NnueNetwork Nnue::s_Network;
+bool Nnue::s_Loaded = false;
+SimdLevel Nnue::s_SimdLevel = SimdLevel::SCALAR;
+
+static SimdLevel SelectSimdLevel() {
+	if ( CpuFeatures::HasAvx512() ) {
+		return SimdLevel::AVX512;
+	}
+
+	return CpuFeatures::HasAvx2() ? SimdLevel::AVX2 : SimdLevel::SCALAR;
+}
+
+[[maybe_unused]] static const bool s_SimdLevelReady = Nnue::SetSimdLevel( SelectSimdLevel() );
+
+static void UpdateRowScalar( const int16_t *input, int16_t *output, const int16_t *const *added,
+                             const uint32_t addedCount, const int16_t *const *removed, const uint32_t removedCount ) {
+	for ( uint32_t i = 0; i < NNUE_HIDDEN_SIZE; i++ ) {
+		int32_t value = input[i];
+		for ( uint32_t j = 0; j < addedCount; j++ ) {
+			value += added[j][i];
+		}
+		for ( uint32_t j = 0; j < removedCount; j++ ) {
+			value -= removed[j][i];
+		}
+
+		output[i] = static_cast<int16_t>(value);
+	}
+}
+
+KITSUNE_TARGET( "avx2" )
+static void UpdateRowAvx2( const int16_t *input, int16_t *output, const int16_t *const *added,
+                           const uint32_t addedCount, const int16_t *const *removed, const uint32_t removedCount ) {
+	for ( uint32_t i = 0; i < NNUE_HIDDEN_SIZE; i += 16 ) {
+		__m256i value = _mm256_load_si256( reinterpret_cast<const __m256i*>(input + i) );
+		for ( uint32_t j = 0; j < addedCount; j++ ) {
+			value = _mm256_add_epi16( value, _mm256_load_si256( reinterpret_cast<const __m256i*>(added[j] + i) ) );
+		}
+		for ( uint32_t j = 0; j < removedCount; j++ ) {
+			value = _mm256_sub_epi16( value, _mm256_load_si256( reinterpret_cast<const __m256i*>(removed[j] + i) ) );
+		}
+
+		_mm256_store_si256( reinterpret_cast<__m256i*>(output + i), value );
+	}
+}
+
+KITSUNE_TARGET( "avx512f,avx512bw" )
+static void UpdateRowAvx512( const int16_t *input, int16_t *output, const int16_t *const *added,
+                             const uint32_t addedCount, const int16_t *const *removed, const uint32_t removedCount ) {
+	for ( uint32_t i = 0; i < NNUE_HIDDEN_SIZE; i += 32 ) {
+		__m512i value = _mm512_load_si512( input + i );
+		for ( uint32_t j = 0; j < addedCount; j++ ) {
+			value = _mm512_add_epi16( value, _mm512_load_si512( added[j] + i ) );
+		}
+		for ( uint32_t j = 0; j < removedCount; j++ ) {
+			value = _mm512_sub_epi16( value, _mm512_load_si512( removed[j] + i ) );
+		}
+
+		_mm512_store_si512( output + i, value );
+	}
+}
+
+// Sum of clamp(x, 0, QA)^2 * w over both perspectives, still scaled by QA * QA * QB.
+static int32_t OutputScalar( const int16_t *us, const int16_t *them, const int16_t ( &weights )[2][NNUE_HIDDEN_SIZE] ) {
+	int32_t sum = 0;
+	for ( uint32_t i = 0; i < NNUE_HIDDEN_SIZE; i++ ) {
+		const int32_t ours = std::clamp<int32_t>( us[i], 0, NNUE_QA );
+		const int32_t theirs = std::clamp<int32_t>( them[i], 0, NNUE_QA );
+		sum += ours * ours * weights[0][i] + theirs * theirs * weights[1][i];
+	}
+
+	return sum;
+}
+
+// Multiplying the activation by the weight first keeps the product in int16, so madd squares and widens in one step.
+KITSUNE_TARGET( "avx2" )
+static int32_t OutputAvx2( const int16_t *us, const int16_t *them, const int16_t ( &weights )[2][NNUE_HIDDEN_SIZE] ) {
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i qa = _mm256_set1_epi16( NNUE_QA );
+	__m256i sum = zero;
+
+	for ( uint32_t side = 0; side < 2; side++ ) {
+		const int16_t *values = side == 0 ? us : them;
+		for ( uint32_t i = 0; i < NNUE_HIDDEN_SIZE; i += 16 ) {
+			const __m256i value = _mm256_load_si256( reinterpret_cast<const __m256i*>(values + i) );
+			const __m256i weight = _mm256_load_si256( reinterpret_cast<const __m256i*>(weights[side] + i) );
+			const __m256i clipped = _mm256_min_epi16( _mm256_max_epi16( value, zero ), qa );
+			sum = _mm256_add_epi32( sum, _mm256_madd_epi16( _mm256_mullo_epi16( clipped, weight ), clipped ) );
+		}
+	}
+
+	__m128i total = _mm_add_epi32( _mm256_castsi256_si128( sum ), _mm256_extracti128_si256( sum, 1 ) );
+	total = _mm_add_epi32( total, _mm_shuffle_epi32( total, 0x4E ) );
+	total = _mm_add_epi32( total, _mm_shuffle_epi32( total, 0xB1 ) );
+	return _mm_cvtsi128_si32( total );
+}
+
+KITSUNE_TARGET( "avx512f,avx512bw" )
+static int32_t OutputAvx512( const int16_t *us, const int16_t *them, const int16_t ( &weights )[2][NNUE_HIDDEN_SIZE] ) {
+	const __m512i zero = _mm512_setzero_si512();
+	const __m512i qa = _mm512_set1_epi16( NNUE_QA );
+	__m512i sum = zero;
+
+	for ( uint32_t side = 0; side < 2; side++ ) {
+		const int16_t *values = side == 0 ? us : them;
+		for ( uint32_t i = 0; i < NNUE_HIDDEN_SIZE; i += 32 ) {
+			const __m512i value = _mm512_load_si512( values + i );
+			const __m512i weight = _mm512_load_si512( weights[side] + i );
+			const __m512i clipped = _mm512_min_epi16( _mm512_max_epi16( value, zero ), qa );
+			sum = _mm512_add_epi32( sum, _mm512_madd_epi16( _mm512_mullo_epi16( clipped, weight ), clipped ) );
+		}
+	}
+
+	return _mm512_reduce_add_epi32( sum );
+}
+
+bool Nnue::Load( const std::string &path ) {
+	std::ifstream file( path, std::ios::binary );
+	if ( !file ) {
+		return false;
+	}
+
+	const std::vector<char> data( ( std::istreambuf_iterator( file ) ), std::istreambuf_iterator<char>() );
+	return Load( data.data(), data.size() );
+}
+
+bool Nnue::Load( const void *data, const size_t size ) {
+	if ( size != NNUE_NETWORK_BYTES && size != ( NNUE_NETWORK_BYTES + 63 ) / 64 * 64 ) {
+		return false;
+	}
+
+	const auto network = std::make_unique<NnueNetwork>();
+	std::memcpy( network.get(), data, NNUE_NETWORK_BYTES );
+
+	for ( const auto &row : network->m_OutputWeights ) {
+		for ( const int16_t weight : row ) {
+			if ( weight < -MAX_OUTPUT_WEIGHT || weight > MAX_OUTPUT_WEIGHT ) {
+				return false;
+			}
+		}
+	}
+
+	s_Network = *network;
+	s_Loaded = true;
+	return true;
+}
+
+bool Nnue::SetSimdLevel( const SimdLevel level ) {
+	if ( ( level == SimdLevel::AVX512 && !CpuFeatures::HasAvx512() ) ||
+	     ( level == SimdLevel::AVX2 && !CpuFeatures::HasAvx2() ) ) {
+		return false;
+	}
+
+	s_SimdLevel = level;
+	return true;
+}
+
+std::string Nnue::GetSimdLevelName() {
+	switch ( s_SimdLevel ) {
+		case SimdLevel::AVX512: return "AVX-512";
+		case SimdLevel::AVX2: return "AVX2";
+		default: return "Scalar";
+	}
+}
+
+void Nnue::Refresh( const Board &board, Accumulator &accumulator ) {
+	for ( const SideToMove perspective : { WHITE, BLACK } ) {
+		const Square kingSquare = board.GetKingSquare( perspective );
+
+		uint32_t features[32];
+		uint32_t count = 0;
+		for ( int piece = PAWN; piece <= KING; piece++ ) {
+			for ( const SideToMove side : { WHITE, BLACK } ) {
+				board.GetPieceMask( static_cast<PieceType>(piece), side ).Map( [&]( const Square square ) {
+					features[count++] = GetFeatureIndex( static_cast<PieceType>(piece), side, square, perspective,
+					                                     kingSquare );
+				} );
+			}
+		}
+
+		UpdateRow( s_Network.m_FeatureBiases, accumulator.m_Values[perspective], features, count, nullptr, 0 );
+	}
+}
+
+// Rows are gathered first so the kernels keep the running sum in registers across all features.
+void Nnue::UpdateRow( const int16_t *input, int16_t *output, const uint32_t *added, const uint32_t addedCount,
+                      const uint32_t *removed, const uint32_t removedCount ) {
+	const int16_t *addedRows[32];
+	const int16_t *removedRows[32];
+	for ( uint32_t i = 0; i < addedCount; i++ ) {
+		addedRows[i] = s_Network.m_FeatureWeights[added[i]];
+	}
+	for ( uint32_t i = 0; i < removedCount; i++ ) {
+		removedRows[i] = s_Network.m_FeatureWeights[removed[i]];
+	}
+
+	switch ( s_SimdLevel ) {
+		case SimdLevel::AVX512: UpdateRowAvx512( input, output, addedRows, addedCount, removedRows, removedCount );
+			break;
+		case SimdLevel::AVX2: UpdateRowAvx2( input, output, addedRows, addedCount, removedRows, removedCount );
+			break;
+		default: UpdateRowScalar( input, output, addedRows, addedCount, removedRows, removedCount );
+			break;
+	}
+}
+
+int32_t Nnue::Evaluate( const Accumulator &accumulator, const SideToMove side ) {
+	const int16_t *us = accumulator.m_Values[side];
+	const int16_t *them = accumulator.m_Values[~side];
+
+	int32_t sum;
+	switch ( s_SimdLevel ) {
+		case SimdLevel::AVX512: sum = OutputAvx512( us, them, s_Network.m_OutputWeights );
+			break;
+		case SimdLevel::AVX2: sum = OutputAvx2( us, them, s_Network.m_OutputWeights );
+			break;
+		default: sum = OutputScalar( us, them, s_Network.m_OutputWeights );
+			break;
+	}
+
+	return ( sum / NNUE_QA + s_Network.m_OutputBias ) * NNUE_SCALE / ( NNUE_QA * NNUE_QB );
+}
+
+int32_t Nnue::Evaluate( const Board &board ) {
+	Accumulator accumulator;
+	Refresh( board, accumulator );
+	return Evaluate( accumulator, board.GetSideToMove() );
+}
@@ -0,0 +1,24 @@
+#include "KitsuneEngine/eval/pawn_hash_table.h"
+
+#include <algorithm>
+
+#include "KitsuneEngine/eval/evaluation.h"
+
+const PawnEntry& PawnHashTable::Probe( const Board &board ) {
+	const uint64_t key = board.GetPawnHash();
+	PawnEntry &entry = m_Entries[key & ( PAWN_HASH_ENTRIES - 1 )];
+
+	m_Stats.m_Probes++;
+	if ( entry.m_Key == key ) {
+		m_Stats.m_Hits++;
+		return entry;
+	}
+
+	entry = Evaluation::EvaluatePawns( board );
+	return entry;
+}
+
+void PawnHashTable::Clear() {
+	std::ranges::fill( m_Entries, PawnEntry{ } );
+	ResetStats();
+}
@@ -0,0 +1,86 @@
+#include "KitsuneEngine/mapped_file.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool MappedFile::Open( const std::string &path ) {
+	Close();
+
+#if defined(_WIN32)
+	const HANDLE file = CreateFileA( path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+	                                 FILE_FLAG_RANDOM_ACCESS, nullptr );
+	if ( file == INVALID_HANDLE_VALUE ) {
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	if ( !GetFileSizeEx( file, &size ) || size.QuadPart == 0 ) {
+		CloseHandle( file );
+		return false;
+	}
+
+	const HANDLE mapping = CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+	const void *data = mapping ? MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) : nullptr;
+	if ( !data ) {
+		if ( mapping ) {
+			CloseHandle( mapping );
+		}
+		CloseHandle( file );
+		return false;
+	}
+
+	m_File = file;
+	m_Mapping = mapping;
+	m_Size = static_cast<size_t>(size.QuadPart);
+#else
+	const int file = open( path.c_str(), O_RDONLY );
+	if ( file < 0 ) {
+		return false;
+	}
+
+	struct stat status{ };
+	if ( fstat( file, &status ) != 0 || status.st_size == 0 ) {
+		close( file );
+		return false;
+	}
+
+	// The mapping keeps the file alive on its own.
+	void *data = mmap( nullptr, status.st_size, PROT_READ, MAP_SHARED, file, 0 );
+	close( file );
+	if ( data == MAP_FAILED ) {
+		return false;
+	}
+
+	madvise( data, status.st_size, MADV_RANDOM );
+	m_Size = static_cast<size_t>(status.st_size);
+#endif
+
+	m_Data = static_cast<const uint8_t*>(data);
+	return true;
+}
+
+void MappedFile::Close() {
+	if ( !m_Data ) {
+		return;
+	}
+
+#if defined(_WIN32)
+	UnmapViewOfFile( m_Data );
+	CloseHandle( m_Mapping );
+	CloseHandle( m_File );
+	m_File = m_Mapping = nullptr;
+#else
+	munmap( const_cast<uint8_t*>(m_Data), m_Size );
+#endif
+
+	m_Data = nullptr;
+	m_Size = 0;
+}
@@ -0,0 +1,366 @@
+#include "KitsuneEngine/search/search.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <format>
+
+#include "KitsuneEngine/core/move_picker.h"
+#include "KitsuneEngine/core/attacks/attacks.h"
+#include "KitsuneEngine/eval/evaluation.h"
+#include "KitsuneEngine/tablebase/syzygy.h"
+
+// Limits other than an explicit stop are only checked once every this many nodes, reading the clock is not free.
+static constexpr uint64_t TIME_CHECK_INTERVAL = 1024;
+
+static bool IsTTCutoff( const TTData &data, const int32_t alpha, const int32_t beta ) {
+	return data.m_Bound == TTBound::EXACT || ( data.m_Bound == TTBound::LOWER && data.m_Score >= beta ) ||
+	       ( data.m_Bound == TTBound::UPPER && data.m_Score <= alpha );
+}
+
+// Helper threads skip iterations in a pattern that depends on their index, taken from the classic Lazy SMP scheme.
+static constexpr uint8_t SKIP_SIZE[20]{ 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4 };
+static constexpr uint8_t SKIP_PHASE[20]{ 0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7 };
+
+Search::Search( TranspositionTable &table, const std::atomic<bool> &stopSignal, const uint32_t threadIndex )
+	: m_Table( table ), m_ThreadIndex( threadIndex ), m_StopSignal( stopSignal ) {
+}
+
+SearchResult Search::Run( const Board &board, const SearchLimits &limits, const SearchReport &report,
+                          const std::vector<uint64_t> &history ) {
+	m_Board = board;
+	m_Accumulators.Reset();
+	m_PawnTable.ResetStats();
+	m_CastleMask = board.GenerateCastleMask();
+	m_UndoStack.Clear();
+
+	// Nothing before the last capture or pawn move can repeat.
+	m_History.Clear();
+	const size_t first = history.size() - std::min<size_t>( history.size(), board.GetHalfMoves() );
+	for ( size_t i = first; i < history.size(); i++ ) {
+		m_History.Push( history[i] );
+	}
+	m_History.Push( board.GetHash() );
+
+	m_Limits = limits;
+	m_StartTime = std::chrono::steady_clock::now();
+	m_Stopped = false;
+
+	m_Nodes.store( 0, std::memory_order_relaxed );
+	m_RootBestMove = Move();
+
+	SearchResult result{ };
+
+	// With the position in the tablebases the move is already known, the DTZ tables keep the fifty-move rule in mind.
+	Move tbMove;
+	WdlScore tbScore;
+	if ( limits.m_UseTablebases && Syzygy::CanProbe( board ) && Syzygy::ProbeRoot( board, tbMove, tbScore ) ) {
+		const int32_t score = tbScore == WdlScore::WIN
+			                      ? TB_WIN_SCORE
+			                      : tbScore == WdlScore::LOSS
+			                      ? -TB_WIN_SCORE
+			                      : DRAW_SCORE;
+		m_RootBestMove = tbMove;
+		result = { tbMove, score, 1, GetNodes(), GetElapsedMilliseconds() };
+		if ( report ) {
+			report( { 1, 0, score, GetNodes(), result.m_Milliseconds, &m_RootBestMove, 1 } );
+		}
+
+		return result;
+	}
+
+	const uint8_t maxDepth = std::clamp<uint8_t>( limits.m_Depth, 1, MAX_SEARCH_DEPTH );
+
+	for ( m_RootDepth = 1; m_RootDepth <= maxDepth; m_RootDepth++ ) {
+		if ( IsDepthSkipped( m_RootDepth ) ) {
+			continue;
+		}
+
+		m_SelDepth = 0;
+		const int32_t score = Negamax<true>( -INFINITE_SCORE, INFINITE_SCORE, m_RootDepth, 0 );
+
+		// A partial iteration is thrown away, the previous one was searched to full width.
+		if ( m_Stopped ) {
+			break;
+		}
+
+		m_RootBestMove = m_PvLength[0] > 0 ? m_PvTable[0][0] : Move();
+		result = { m_RootBestMove, score, m_RootDepth, GetNodes(), GetElapsedMilliseconds() };
+
+		// Mated or stalemated at the root.
+		if ( !m_RootBestMove ) {
+			break;
+		}
+
+		if ( report ) {
+			report( { m_RootDepth, m_SelDepth, score, GetNodes(), result.m_Milliseconds, m_PvTable[0], m_PvLength[0] } );
+		}
+
+		if ( std::abs( score ) >= MATE_BOUND && MATE_SCORE - std::abs( score ) <= m_RootDepth ) {
+			break;
+		}
+	}
+
+	result.m_Nodes = GetNodes();
+	result.m_Milliseconds = GetElapsedMilliseconds();
+	return result;
+}
+
+std::string Search::ScoreToString( const int32_t score ) {
+	if ( std::abs( score ) >= MATE_BOUND ) {
+		const int32_t moves = ( MATE_SCORE - std::abs( score ) + 1 ) / 2;
+		return std::format( "mate {}", score > 0 ? moves : -moves );
+	}
+
+	return std::format( "cp {}", score );
+}
+
+template<bool PV_NODE>
+int32_t Search::Negamax( int32_t alpha, const int32_t beta, const int32_t depth, const uint8_t ply ) {
+	if ( depth <= 0 ) {
+		return Quiescence( alpha, beta, ply );
+	}
+
+	m_PvLength[ply] = 0;
+	CountNode();
+
+	if ( ShouldStop() ) {
+		return 0;
+	}
+
+	if ( ply > 0 ) {
+		if ( m_Board.GetHalfMoves() >= 100 || m_Board.IsInsufficientMaterial() ||
+		     m_History.IsRepetition( m_Board.GetHalfMoves(), ply ) ) {
+			return DRAW_SCORE;
+		}
+
+		if ( ply >= MAX_SEARCH_DEPTH ) {
+			return Evaluate();
+		}
+
+		// A move back to an earlier position is available, so the side to move can always get at least a draw.
+		if ( alpha < DRAW_SCORE && m_History.HasUpcomingRepetition( m_Board, ply ) ) {
+			alpha = DRAW_SCORE;
+			if ( alpha >= beta ) {
+				return alpha;
+			}
+		}
+	}
+
+	const uint64_t hash = m_Board.GetHash();
+	TTData ttData{ };
+	const bool ttHit = m_Table.Probe( hash, ply, ttData );
+	if ( !PV_NODE && ttHit && ttData.m_Depth >= depth && IsTTCutoff( ttData, alpha, beta ) ) {
+		return ttData.m_Score;
+	}
+
+	// Right after a capture or a pawn move the WDL tables give the exact result. Cursed wins and blessed losses are
+	// draws under the fifty-move rule.
+	if ( ply > 0 && m_Board.GetHalfMoves() == 0 && m_Limits.m_UseTablebases && Syzygy::CanProbe( m_Board ) ) {
+		WdlScore wdl;
+		if ( Syzygy::ProbeWdl( m_Board, wdl ) ) {
+			const int32_t tbScore = wdl == WdlScore::WIN
+				                        ? TB_WIN_SCORE - ply
+				                        : wdl == WdlScore::LOSS
+				                        ? -TB_WIN_SCORE + ply
+				                        : DRAW_SCORE;
+			const TTBound tbBound = wdl == WdlScore::WIN
+				                        ? TTBound::LOWER
+				                        : wdl == WdlScore::LOSS
+				                        ? TTBound::UPPER
+				                        : TTBound::EXACT;
+
+			if ( IsTTCutoff( { Move(), tbScore, 0, tbBound }, alpha, beta ) ) {
+				m_Table.Store( hash, Move(), tbScore, static_cast<uint8_t>(std::min( depth + 6, MAX_SEARCH_DEPTH - 1 )),
+				               tbBound, ply );
+				return tbScore;
+			}
+		}
+	}
+
+	const bool inCheck = Attacks::IsInCheck( m_Board );
+	const int32_t childDepth = depth - 1 + inCheck;
+
+	auto picker = MovePicker( m_Board, m_CastleMask, ply == 0 && m_RootBestMove ? m_RootBestMove : ttData.m_Move );
+
+	const int32_t originalAlpha = alpha;
+	int32_t bestScore = -INFINITE_SCORE;
+	Move bestMove;
+	uint8_t movesSearched = 0;
+
+	while ( const Move move = picker.Next() ) {
+		m_Board.MakeMove( move, m_CastleMask, m_UndoStack.Push(), &m_Accumulators.Push() );
+		m_Table.Prefetch( m_Board.GetHash() );
+		m_History.Push( m_Board.GetHash() );
+
+		int32_t score;
+		if ( movesSearched == 0 ) {
+			score = -Negamax<PV_NODE>( -beta, -alpha, childDepth, ply + 1 );
+		} else {
+			score = -Negamax<false>( -alpha - 1, -alpha, childDepth, ply + 1 );
+			if ( PV_NODE && !m_Stopped && score > alpha && score < beta ) {
+				score = -Negamax<true>( -beta, -alpha, childDepth, ply + 1 );
+			}
+		}
+
+		m_Board.UnmakeMove( move, m_UndoStack.Pop() );
+		m_Accumulators.Pop();
+		m_History.Pop();
+		movesSearched++;
+
+		if ( m_Stopped ) {
+			return 0;
+		}
+
+		if ( score > bestScore ) {
+			bestScore = score;
+
+			if ( score > alpha ) {
+				alpha = score;
+				bestMove = move;
+
+				if constexpr ( PV_NODE ) {
+					UpdatePv( move, ply );
+				}
+
+				if ( alpha >= beta ) {
+					break;
+				}
+			}
+		}
+	}
+
+	if ( movesSearched == 0 ) {
+		return inCheck ? -MATE_SCORE + ply : DRAW_SCORE;
+	}
+
+	const TTBound bound = bestScore >= beta
+		                      ? TTBound::LOWER
+		                      : alpha > originalAlpha
+		                      ? TTBound::EXACT
+		                      : TTBound::UPPER;
+	m_Table.Store( hash, bestMove, bestScore, static_cast<uint8_t>(depth), bound, ply );
+
+	return bestScore;
+}
+
+// Stands pat on the static evaluation and only searches noisy moves that do not lose material by SEE, unless in check
+// where every evasion is tried.
+int32_t Search::Quiescence( int32_t alpha, const int32_t beta, const uint8_t ply ) {
+	m_PvLength[ply] = 0;
+	CountNode();
+	m_SelDepth = std::max( m_SelDepth, ply );
+
+	if ( ShouldStop() ) {
+		return 0;
+	}
+
+	if ( ply >= MAX_SEARCH_DEPTH ) {
+		return Evaluate();
+	}
+
+	const uint64_t hash = m_Board.GetHash();
+	TTData ttData{ };
+	if ( m_Table.Probe( hash, ply, ttData ) && IsTTCutoff( ttData, alpha, beta ) ) {
+		return ttData.m_Score;
+	}
+
+	const bool inCheck = Attacks::IsInCheck( m_Board );
+	int32_t bestScore = -INFINITE_SCORE;
+
+	if ( !inCheck ) {
+		bestScore = Evaluate();
+		if ( bestScore >= beta ) {
+			return bestScore;
+		}
+
+		alpha = std::max( alpha, bestScore );
+	}
+
+	auto picker = MovePicker( m_Board, m_CastleMask, ttData.m_Move, !inCheck );
+	Move bestMove;
+
+	while ( const Move move = picker.Next() ) {
+		m_Board.MakeMove( move, m_CastleMask, m_UndoStack.Push(), &m_Accumulators.Push() );
+		m_Table.Prefetch( m_Board.GetHash() );
+		const int32_t score = -Quiescence( -beta, -alpha, ply + 1 );
+		m_Board.UnmakeMove( move, m_UndoStack.Pop() );
+		m_Accumulators.Pop();
+
+		if ( m_Stopped ) {
+			return 0;
+		}
+
+		if ( score > bestScore ) {
+			bestScore = score;
+
+			if ( score > alpha ) {
+				alpha = score;
+				bestMove = move;
+				UpdatePv( move, ply );
+
+				if ( alpha >= beta ) {
+					break;
+				}
+			}
+		}
+	}
+
+	if ( inCheck && bestScore == -INFINITE_SCORE ) {
+		return -MATE_SCORE + ply;
+	}
+
+	m_Table.Store( hash, bestMove, bestScore, 0, bestScore >= beta ? TTBound::LOWER : TTBound::UPPER, ply );
+
+	return bestScore;
+}
+
+// Clamped so an evaluation can never be mistaken for a tablebase or mate score.
+int32_t Search::Evaluate() {
+	const int32_t score = m_Limits.m_UseNetwork && Nnue::IsLoaded()
+		                      ? m_Accumulators.Evaluate( m_Board )
+		                      : Evaluation::Evaluate( m_Board, m_PawnTable );
+	return std::clamp( score, -EVAL_BOUND, EVAL_BOUND );
+}
+
+void Search::UpdatePv( const Move move, const uint8_t ply ) {
+	const uint8_t childLength = m_PvLength[ply + 1];
+	m_PvTable[ply][0] = move;
+	std::copy_n( m_PvTable[ply + 1], childLength, m_PvTable[ply] + 1 );
+	m_PvLength[ply] = childLength + 1;
+}
+
+// Depth 1 always completes so there is a move to play, however tight the limits.
+bool Search::ShouldStop() {
+	if ( m_Stopped ) {
+		return true;
+	}
+
+	if ( m_RootDepth == 1 ) {
+		return false;
+	}
+
+	const uint64_t nodes = GetNodes();
+	if ( m_Limits.m_Nodes && nodes >= m_Limits.m_Nodes ) {
+		m_Stopped = true;
+	} else if ( nodes % TIME_CHECK_INTERVAL == 0 ) {
+		m_Stopped = m_StopSignal.load( std::memory_order_relaxed ) ||
+		            ( m_Limits.m_Milliseconds && GetElapsedMilliseconds() >= m_Limits.m_Milliseconds ) ||
+		            ( m_Limits.m_Nodes && m_SharedNodes && m_SharedNodes() >= m_Limits.m_Nodes );
+	}
+
+	return m_Stopped;
+}
+
+bool Search::IsDepthSkipped( const uint8_t depth ) const {
+	if ( m_ThreadIndex == 0 || depth == 1 ) {
+		return false;
+	}
+
+	const uint32_t index = ( m_ThreadIndex - 1 ) % std::size( SKIP_SIZE );
+	return ( ( depth + SKIP_PHASE[index] ) / SKIP_SIZE[index] ) % 2 != 0;
+}
+
+uint64_t Search::GetElapsedMilliseconds() const {
+	return std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - m_StartTime ).
+		count();
+}
@@ -0,0 +1,84 @@
+#include "KitsuneEngine/search/search_pool.h"
+
+SearchPool::SearchPool( TranspositionTable &table, const uint32_t threadCount )
+	: m_Table( table ) {
+	SetThreadCount( threadCount );
+}
+
+void SearchPool::SetThreadCount( const uint32_t threadCount ) {
+	const uint32_t count = threadCount > 0 ? threadCount : 1;
+
+	m_Threads = std::make_unique<ThreadPool>( count );
+	m_Searches.clear();
+	for ( uint32_t i = 0; i < count; i++ ) {
+		m_Searches.push_back( std::make_unique<Search>( m_Table, m_StopSignal, i ) );
+	}
+
+	// The node limit counts every thread, so each of them checks the total.
+	if ( count > 1 ) {
+		for ( const auto &search : m_Searches ) {
+			search->SetSharedNodes( [this] {
+				return GetNodes();
+			} );
+		}
+	}
+
+	m_Results.assign( count, SearchResult{ } );
+}
+
+void SearchPool::Start( const Board &board, const SearchLimits &limits, SearchReport report,
+                        std::vector<uint64_t> history ) {
+	m_StopSignal.store( false, std::memory_order_relaxed );
+	m_Table.NewSearch();
+
+	// Shared read-only by every thread until Wait returns.
+	m_History = std::move( history );
+
+	m_Threads->Submit( [this, board, limits, report = std::move( report )] {
+		const SearchReport summedReport = !report ? SearchReport() : [this, &report]( const SearchInfo &info ) {
+			SearchInfo summed = info;
+			summed.m_Nodes = GetNodes();
+			report( summed );
+		};
+
+		m_Results[0] = m_Searches[0]->Run( board, limits, summedReport, m_History );
+		Stop();
+	} );
+
+	// Helpers are bounded by depth and the shared node count, the main thread stops them once it is done.
+	const SearchLimits helperLimits{ .m_Depth = limits.m_Depth,
+	                                 .m_Nodes = limits.m_Nodes,
+	                                 .m_UseTablebases = limits.m_UseTablebases,
+	                                 .m_UseNetwork = limits.m_UseNetwork };
+	for ( uint32_t i = 1; i < m_Searches.size(); i++ ) {
+		m_Threads->Submit( [this, board, helperLimits, i] {
+			m_Results[i] = m_Searches[i]->Run( board, helperLimits, nullptr, m_History );
+		} );
+	}
+}
+
+SearchResult SearchPool::Wait() {
+	m_Threads->Wait();
+
+	SearchResult best = m_Results[0];
+	for ( uint32_t i = 1; i < m_Results.size(); i++ ) {
+		const SearchResult &result = m_Results[i];
+		if ( result.m_BestMove && ( result.m_Depth > best.m_Depth ||
+		                            ( result.m_Depth == best.m_Depth && result.m_Score > best.m_Score ) ) ) {
+			best = result;
+		}
+	}
+
+	best.m_Nodes = GetNodes();
+	best.m_Milliseconds = m_Results[0].m_Milliseconds;
+	return best;
+}
+
+uint64_t SearchPool::GetNodes() const {
+	uint64_t nodes = 0;
+	for ( const auto &search : m_Searches ) {
+		nodes += search->GetNodes();
+	}
+
+	return nodes;
+}
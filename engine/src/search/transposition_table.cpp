@@ -0,0 +1,217 @@
+#include "KitsuneEngine/search/transposition_table.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "KitsuneEngine/search/search.h"
+
+// Data word layout: move (16) | score (16) | depth (8) | bound (2) | age (6).
+static constexpr uint8_t SCORE_SHIFT = 16;
+static constexpr uint8_t DEPTH_SHIFT = 32;
+static constexpr uint8_t BOUND_SHIFT = 40;
+static constexpr uint8_t AGE_SHIFT = 42;
+
+// Transparent huge pages are only used for 2 MB aligned ranges, so the table is aligned and padded to that.
+static constexpr uint64_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+static constexpr uint64_t HASHFULL_SAMPLE_BUCKETS = 250;
+
+static constexpr uint64_t PackData( const Move move, const int32_t score, const uint8_t depth, const TTBound bound,
+                                    const uint8_t age ) {
+	return static_cast<uint64_t>(static_cast<uint16_t>(move)) |
+	       static_cast<uint64_t>(static_cast<uint16_t>(static_cast<int16_t>(score))) << SCORE_SHIFT |
+	       static_cast<uint64_t>(depth) << DEPTH_SHIFT |
+	       static_cast<uint64_t>(bound) << BOUND_SHIFT |
+	       static_cast<uint64_t>(age) << AGE_SHIFT;
+}
+
+static constexpr uint8_t GetDataDepth( const uint64_t data ) {
+	return static_cast<uint8_t>(data >> DEPTH_SHIFT);
+}
+
+static constexpr uint8_t GetDataAge( const uint64_t data ) {
+	return static_cast<uint8_t>(data >> AGE_SHIFT) & 0x3F;
+}
+
+static constexpr TTBound GetDataBound( const uint64_t data ) {
+	return static_cast<TTBound>(data >> BOUND_SHIFT & 3);
+}
+
+TranspositionTable::TranspositionTable( const uint32_t megabytes ) {
+	Resize( megabytes );
+}
+
+TranspositionTable::~TranspositionTable() {
+	Free();
+}
+
+bool TranspositionTable::Resize( const uint32_t megabytes ) {
+	const uint64_t bytes = static_cast<uint64_t>(megabytes) * 1024 * 1024;
+	const uint64_t previousBucketCount = m_BucketCount;
+
+	Free();
+	const bool allocated = Allocate( std::bit_floor( std::max<uint64_t>( bytes / sizeof( Bucket ), 1 ) ) );
+
+	// The old table was freed first, so its size normally fits again; it is halved for as long as it does not.
+	uint64_t bucketCount = std::max<uint64_t>( previousBucketCount, 1 );
+	while ( !m_Buckets && bucketCount > 0 && !Allocate( bucketCount ) ) {
+		bucketCount /= 2;
+	}
+
+	Clear();
+	return allocated;
+}
+
+void TranspositionTable::Clear( const uint32_t threadCount ) {
+	if ( !m_Buckets ) {
+		return;
+	}
+
+	auto *const memory = reinterpret_cast<uint8_t*>(m_Buckets);
+	const uint64_t bytes = GetSizeInBytes();
+	const uint32_t threads = static_cast<uint32_t>(std::clamp<uint64_t>( threadCount, 1, m_BucketCount ));
+
+	const auto clearRange = [memory, bytes, threads]( const uint32_t index ) {
+		const uint64_t begin = bytes * index / threads / sizeof( Bucket ) * sizeof( Bucket );
+		const uint64_t end = bytes * ( index + 1 ) / threads / sizeof( Bucket ) * sizeof( Bucket );
+		std::memset( memory + begin, 0, end - begin );
+	};
+
+	if ( threads == 1 ) {
+		clearRange( 0 );
+	} else {
+		std::vector<std::jthread> workers;
+		workers.reserve( threads );
+		for ( uint32_t i = 0; i < threads; i++ ) {
+			workers.emplace_back( clearRange, i );
+		}
+	}
+
+	m_Age = 0;
+}
+
+bool TranspositionTable::Probe( const uint64_t hash, const uint8_t ply, TTData &data ) const {
+	for ( const Entry &entry : m_Buckets[GetIndex( hash )].m_Entries ) {
+		const uint64_t entryData = entry.m_Data.load( std::memory_order_relaxed );
+		if ( ( entry.m_Key.load( std::memory_order_relaxed ) ^ entryData ) != hash ) {
+			continue;
+		}
+
+		int32_t score = static_cast<int16_t>(entryData >> SCORE_SHIFT);
+		if ( score > EVAL_BOUND ) {
+			score -= ply;
+		} else if ( score < -EVAL_BOUND ) {
+			score += ply;
+		}
+
+		data = { Move( static_cast<uint16_t>(entryData) ), score, GetDataDepth( entryData ), GetDataBound( entryData ) };
+		return true;
+	}
+
+	return false;
+}
+
+// Replaces the entry for the same position if there is one, otherwise the shallowest entry, counting every search
+// of age as a lost ply. A store without a move keeps the move already known for the position.
+void TranspositionTable::Store( const uint64_t hash, Move move, int32_t score, const uint8_t depth,
+                                const TTBound bound, const uint8_t ply ) {
+	Entry *replace = nullptr;
+	int32_t replaceWorth = INT32_MAX;
+
+	for ( Entry &entry : m_Buckets[GetIndex( hash )].m_Entries ) {
+		const uint64_t entryData = entry.m_Data.load( std::memory_order_relaxed );
+		if ( ( entry.m_Key.load( std::memory_order_relaxed ) ^ entryData ) == hash ) {
+			if ( !move ) {
+				move = Move( static_cast<uint16_t>(entryData) );
+			}
+
+			// A shallower result only replaces an exact one from the same search if it is exact too.
+			if ( bound != TTBound::EXACT && GetDataAge( entryData ) == m_Age &&
+			     GetDataBound( entryData ) == TTBound::EXACT && GetDataDepth( entryData ) > depth + 2 ) {
+				return;
+			}
+
+			replace = &entry;
+			break;
+		}
+
+		const int32_t ageDistance = ( m_Age - GetDataAge( entryData ) ) & AGE_MASK;
+		const int32_t worth = GetDataDepth( entryData ) - 8 * ageDistance;
+		if ( worth < replaceWorth ) {
+			replace = &entry;
+			replaceWorth = worth;
+		}
+	}
+
+	if ( score > EVAL_BOUND ) {
+		score += ply;
+	} else if ( score < -EVAL_BOUND ) {
+		score -= ply;
+	}
+
+	const uint64_t data = PackData( move, score, depth, bound, m_Age );
+	replace->m_Key.store( hash ^ data, std::memory_order_relaxed );
+	replace->m_Data.store( data, std::memory_order_relaxed );
+}
+
+uint32_t TranspositionTable::GetHashfull() const {
+	const uint64_t sampleBuckets = std::min( HASHFULL_SAMPLE_BUCKETS, m_BucketCount );
+	uint64_t used = 0;
+
+	for ( uint64_t i = 0; i < sampleBuckets; i++ ) {
+		for ( const Entry &entry : m_Buckets[i].m_Entries ) {
+			const uint64_t entryData = entry.m_Data.load( std::memory_order_relaxed );
+			used += GetDataBound( entryData ) != TTBound::NONE && GetDataAge( entryData ) == m_Age;
+		}
+	}
+
+	return static_cast<uint32_t>(used * 1000 / ( sampleBuckets * std::size( m_Buckets[0].m_Entries ) ));
+}
+
+bool TranspositionTable::Allocate( const uint64_t bucketCount ) {
+	const uint64_t bytes = bucketCount * sizeof( Bucket );
+	const uint64_t allocatedBytes = ( bytes + HUGE_PAGE_SIZE - 1 ) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+
+#if defined(_MSC_VER)
+	auto *const buckets = static_cast<Bucket*>(_aligned_malloc( allocatedBytes, HUGE_PAGE_SIZE ));
+#else
+	auto *const buckets = static_cast<Bucket*>(std::aligned_alloc( HUGE_PAGE_SIZE, allocatedBytes ));
+#endif
+
+	if ( !buckets ) {
+		return false;
+	}
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	madvise( buckets, allocatedBytes, MADV_HUGEPAGE );
+#endif
+
+	m_Buckets = buckets;
+	m_BucketCount = bucketCount;
+	m_AllocatedBytes = allocatedBytes;
+	return true;
+}
+
+void TranspositionTable::Free() {
+	if ( !m_Buckets ) {
+		return;
+	}
+
+#if defined(_MSC_VER)
+	_aligned_free( m_Buckets );
+#else
+	std::free( m_Buckets );
+#endif
+
+	m_Buckets = nullptr;
+	m_BucketCount = 0;
+	m_AllocatedBytes = 0;
+}
@@ -0,0 +1,1120 @@
+#include "KitsuneEngine/tablebase/syzygy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "KitsuneEngine/mapped_file.h"
+#include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/core/attacks/attacks.h"
+
+// The file layout and the position indexing below follow the Syzygy format as read by the reference probing code.
+
+static constexpr uint8_t WDL_MAGIC[4]{ 0x71, 0xE8, 0x23, 0x5D };
+static constexpr uint8_t DTZ_MAGIC[4]{ 0xD7, 0x66, 0x0C, 0xA5 };
+
+#if defined(_WIN32)
+static constexpr char PATH_SEPARATOR = ';';
+#else
+static constexpr char PATH_SEPARATOR = ':';
+#endif
+
+// Flags stored per subtable.
+enum SubtableFlag : uint8_t {
+	FLAG_STM = 1,
+	FLAG_MAPPED = 2,
+	FLAG_WIN_PLIES = 4,
+	FLAG_LOSS_PLIES = 8,
+	FLAG_WIDE = 16,
+	FLAG_SINGLE_VALUE = 128,
+};
+
+// Pieces are numbered 1 to 6 from pawn to king, plus 8 for black.
+static constexpr uint8_t BLACK_PIECE = 8;
+
+// Orders moves by preference at the root; above half of it is a win, below minus half a loss.
+static constexpr int32_t MAX_DTZ = 1 << 18;
+
+enum class ProbeState : int8_t {
+	FAIL,
+	OK,
+	// The table stores the other side to move, the caller has to look one ply ahead.
+	CHANGE_STM,
+	// The best move is a capture or a pawn move, whose value the DTZ table does not hold.
+	ZEROING_BEST_MOVE,
+};
+
+// Huffman decoding data for one subtable: one per side to move, and per file of the leading pawn in pawn tables.
+struct PairsData {
+	uint8_t m_Flags = 0;
+	uint8_t m_MinSymbolLength = 0;
+	uint8_t m_MaxSymbolLength = 0;
+	uint64_t m_BlockSize = 0;
+	uint64_t m_Span = 0;
+	uint32_t m_BlockCount = 0;
+	uint32_t m_BlockLengthCount = 0;
+	uint64_t m_SparseIndexCount = 0;
+
+	// Little endian arrays inside the mapping.
+	const uint8_t *m_LowestSymbols = nullptr;
+	const uint8_t *m_SymbolTree = nullptr;
+	const uint8_t *m_SparseIndex = nullptr;
+	const uint8_t *m_BlockLengths = nullptr;
+	const uint8_t *m_Data = nullptr;
+
+	// m_Base[l] is the lowest code of length l + m_MinSymbolLength, left aligned in 64 bits.
+	std::vector<uint64_t> m_Base;
+
+	// How many values, minus one, each symbol expands to.
+	std::vector<uint8_t> m_SymbolLengths;
+
+	uint8_t m_Pieces[SYZYGY_MAX_PIECES]{ };
+	uint64_t m_GroupIndex[SYZYGY_MAX_PIECES + 1]{ };
+	uint8_t m_GroupLength[SYZYGY_MAX_PIECES + 1]{ };
+
+	// DTZ only: byte offsets into the value map of the win, loss, cursed win and blessed loss sections.
+	uint32_t m_MapOffsets[4]{ };
+};
+
+struct SyzygyTable {
+	std::string m_Path;
+	bool m_IsDtz = false;
+
+	// Set once the file was mapped and parsed, or found to be unusable.
+	std::atomic<bool> m_Ready = false;
+	bool m_Valid = false;
+	MappedFile m_File;
+	const uint8_t *m_DtzMap = nullptr;
+
+	// Material keys with the first side of the file name as white and as black.
+	uint64_t m_Key = 0;
+	uint64_t m_Key2 = 0;
+	uint8_t m_PieceCount = 0;
+	bool m_HasPawns = false;
+	bool m_HasUniquePieces = false;
+
+	// Pawns of the leading color, then of the other one.
+	uint8_t m_PawnCount[2]{ };
+
+	PairsData m_Subtables[2][4];
+
+	[[nodiscard]]
+	PairsData& Get( const uint32_t stm, const uint32_t file ) {
+		return m_Subtables[m_IsDtz ? 0 : stm][m_HasPawns ? file : 0];
+	}
+};
+
+struct TablePair {
+	SyzygyTable m_Wdl;
+	SyzygyTable m_Dtz;
+};
+
+// Index tables shared by every file.
+struct IndexTables {
+	int32_t m_MapPawns[64]{ };
+	int32_t m_MapB1H1H7[64]{ };
+	int32_t m_MapA1D1D4[64]{ };
+	int32_t m_MapKK[10][64]{ };
+	uint64_t m_Binomial[SYZYGY_MAX_PIECES][64]{ };
+	int32_t m_LeadPawnIndex[SYZYGY_MAX_PIECES][64]{ };
+	uint64_t m_LeadPawnsSize[SYZYGY_MAX_PIECES][4]{ };
+};
+
+uint8_t Syzygy::s_MaxPieces = 0;
+
+static std::vector<std::unique_ptr<TablePair>> s_Tables;
+static std::unordered_map<uint64_t, TablePair*> s_TableMap;
+static std::mutex s_MappingMutex;
+
+static std::atomic<uint64_t> s_WdlProbes = 0;
+static std::atomic<uint64_t> s_WdlHits = 0;
+static std::atomic<uint64_t> s_DtzProbes = 0;
+static std::atomic<uint64_t> s_DtzHits = 0;
+
+// Positive above the a1-h8 diagonal, zero on it.
+static int32_t GetDiagonalOffset( const uint8_t square ) {
+	return static_cast<int32_t>(square / 8) - static_cast<int32_t>(square % 8);
+}
+
+static bool AreKingsTouching( const uint8_t first, const uint8_t second ) {
+	return std::abs( first / 8 - second / 8 ) <= 1 && std::abs( first % 8 - second % 8 ) <= 1;
+}
+
+static IndexTables BuildIndexTables() {
+	IndexTables tables;
+
+	int32_t code = 0;
+	for ( uint8_t square = 0; square < 64; square++ ) {
+		if ( GetDiagonalOffset( square ) < 0 ) {
+			tables.m_MapB1H1H7[square] = code++;
+		}
+	}
+
+	// The a1-d1-d4 triangle, with the diagonal squares numbered last.
+	std::vector<uint8_t> diagonal;
+	code = 0;
+	for ( uint8_t square = 0; square <= 27; square++ ) {
+		if ( GetDiagonalOffset( square ) < 0 && square % 8 <= 3 ) {
+			tables.m_MapA1D1D4[square] = code++;
+		} else if ( GetDiagonalOffset( square ) == 0 && square % 8 <= 3 ) {
+			diagonal.push_back( square );
+		}
+	}
+	for ( const uint8_t square : diagonal ) {
+		tables.m_MapA1D1D4[square] = code++;
+	}
+
+	// The 462 legal king pairs with the first king in the triangle, and the second not above the diagonal when the
+	// first is on it. Pairs with both kings on the diagonal come last.
+	std::vector<std::pair<int32_t, uint8_t>> bothOnDiagonal;
+	code = 0;
+	for ( int32_t index = 0; index < 10; index++ ) {
+		for ( uint8_t first = 0; first <= 27; first++ ) {
+			if ( tables.m_MapA1D1D4[first] != index || ( index == 0 && first != 1 ) ) {
+				continue;
+			}
+
+			for ( uint8_t second = 0; second < 64; second++ ) {
+				if ( AreKingsTouching( first, second ) ||
+				     ( GetDiagonalOffset( first ) == 0 && GetDiagonalOffset( second ) > 0 ) ) {
+					continue;
+				}
+
+				if ( GetDiagonalOffset( first ) == 0 && GetDiagonalOffset( second ) == 0 ) {
+					bothOnDiagonal.emplace_back( index, second );
+				} else {
+					tables.m_MapKK[index][second] = code++;
+				}
+			}
+		}
+	}
+	for ( const auto &[index, second] : bothOnDiagonal ) {
+		tables.m_MapKK[index][second] = code++;
+	}
+
+	tables.m_Binomial[0][0] = 1;
+	for ( int32_t n = 1; n < 64; n++ ) {
+		for ( int32_t k = 0; k < SYZYGY_MAX_PIECES && k <= n; k++ ) {
+			tables.m_Binomial[k][n] = ( k > 0 ? tables.m_Binomial[k - 1][n - 1] : 0 ) +
+			                          ( k < n ? tables.m_Binomial[k][n - 1] : 0 );
+		}
+	}
+
+	// Pawn squares a2 to h7 numbered from the edges inwards, so the leading pawn is the one with the highest number.
+	int32_t availableSquares = 47;
+	for ( int32_t leadPawns = 1; leadPawns < SYZYGY_MAX_PIECES - 1; leadPawns++ ) {
+		for ( uint8_t file = 0; file < 4; file++ ) {
+			int32_t index = 0;
+			for ( uint8_t rank = 1; rank <= 6; rank++ ) {
+				const uint8_t square = rank * 8 + file;
+				if ( leadPawns == 1 ) {
+					tables.m_MapPawns[square] = availableSquares--;
+					tables.m_MapPawns[square ^ 7] = availableSquares--;
+				}
+
+				tables.m_LeadPawnIndex[leadPawns][square] = index;
+				index += static_cast<int32_t>(tables.m_Binomial[leadPawns - 1][tables.m_MapPawns[square]]);
+			}
+
+			tables.m_LeadPawnsSize[leadPawns][file] = index;
+		}
+	}
+
+	return tables;
+}
+
+static const IndexTables s_Index = BuildIndexTables();
+
+static uint16_t ReadLittleEndian16( const uint8_t *data ) {
+	return static_cast<uint16_t>(data[0] | data[1] << 8);
+}
+
+static uint32_t ReadLittleEndian32( const uint8_t *data ) {
+	return data[0] | data[1] << 8 | data[2] << 16 | static_cast<uint32_t>(data[3]) << 24;
+}
+
+static uint32_t ReadBigEndian32( const uint8_t *data ) {
+	return static_cast<uint32_t>(data[0]) << 24 | data[1] << 16 | data[2] << 8 | data[3];
+}
+
+static uint64_t ReadBigEndian64( const uint8_t *data ) {
+	return static_cast<uint64_t>(ReadBigEndian32( data )) << 32 | ReadBigEndian32( data + 4 );
+}
+
+// Four bits per piece count, kings left out.
+static uint64_t GetMaterialKey( const uint8_t counts[2][5] ) {
+	uint64_t key = 0;
+	for ( uint32_t side = 0; side < 2; side++ ) {
+		for ( uint32_t piece = 0; piece < 5; piece++ ) {
+			key |= static_cast<uint64_t>(counts[side][piece]) << 4 * ( piece + 5 * side );
+		}
+	}
+
+	return key;
+}
+
+static uint64_t GetMaterialKey( const Board &board ) {
+	uint8_t counts[2][5];
+	for ( const SideToMove side : { WHITE, BLACK } ) {
+		for ( int piece = PAWN; piece < KING; piece++ ) {
+			counts[side][piece] = static_cast<uint8_t>(board.GetPieceMask( static_cast<PieceType>(piece), side ).
+				PopCount());
+		}
+	}
+
+	return GetMaterialKey( counts );
+}
+
+static uint8_t GetTablePiece( const Board &board, const Square square ) {
+	return static_cast<uint8_t>(( board.GetPieceOnSquare( square ) + 1 ) |
+	                            ( board.GetPieceColorOnSquare( square ) == BLACK ? BLACK_PIECE : 0 ));
+}
+
+// "KRPvKR" to piece counts, white being the first side. False for anything that is not a table name.
+static bool ParseTableName( const std::string &name, uint8_t counts[2][5], uint8_t &pieceCount ) {
+	static constexpr std::string_view PIECE_LETTERS = "PNBRQ";
+
+	const size_t separator = name.find( 'v' );
+	if ( separator == std::string::npos || name.size() > SYZYGY_MAX_PIECES + 1 ) {
+		return false;
+	}
+
+	pieceCount = 0;
+	for ( uint32_t side = 0; side < 2; side++ ) {
+		const std::string part = side == 0 ? name.substr( 0, separator ) : name.substr( separator + 1 );
+		if ( part.empty() || part[0] != 'K' ) {
+			return false;
+		}
+
+		std::fill_n( counts[side], 5, 0 );
+		for ( size_t i = 1; i < part.size(); i++ ) {
+			const size_t piece = PIECE_LETTERS.find( part[i] );
+			if ( piece == std::string_view::npos ) {
+				return false;
+			}
+			counts[side][piece]++;
+		}
+
+		pieceCount += static_cast<uint8_t>(part.size());
+	}
+
+	return pieceCount <= SYZYGY_MAX_PIECES;
+}
+
+static void SetTableInfo( SyzygyTable &table, const uint8_t counts[2][5], const uint8_t pieceCount ) {
+	const uint8_t swapped[2][5]{
+		{ counts[1][0], counts[1][1], counts[1][2], counts[1][3], counts[1][4] },
+		{ counts[0][0], counts[0][1], counts[0][2], counts[0][3], counts[0][4] },
+	};
+
+	table.m_Key = GetMaterialKey( counts );
+	table.m_Key2 = GetMaterialKey( swapped );
+	table.m_PieceCount = pieceCount;
+	table.m_HasPawns = counts[0][0] + counts[1][0] > 0;
+
+	table.m_HasUniquePieces = false;
+	for ( uint32_t side = 0; side < 2; side++ ) {
+		for ( uint32_t piece = 0; piece < 5; piece++ ) {
+			table.m_HasUniquePieces |= counts[side][piece] == 1;
+		}
+	}
+
+	// The side with fewer pawns leads, it compresses better.
+	const bool whiteLeads = counts[1][0] == 0 || ( counts[0][0] > 0 && counts[1][0] >= counts[0][0] );
+	table.m_PawnCount[0] = whiteLeads ? counts[0][0] : counts[1][0];
+	table.m_PawnCount[1] = whiteLeads ? counts[1][0] : counts[0][0];
+}
+
+// Expands a symbol into its pair of children until reaching the leaves, recording how many values each one stands for.
+static uint8_t SetSymbolLength( PairsData &pairs, const uint16_t symbol, std::vector<bool> &visited ) {
+	visited[symbol] = true;
+
+	const uint8_t *entry = pairs.m_SymbolTree + 3 * symbol;
+	const uint16_t right = static_cast<uint16_t>(entry[2] << 4 | entry[1] >> 4);
+	if ( right == 0xFFF ) {
+		return 0;
+	}
+
+	const uint16_t left = static_cast<uint16_t>(( entry[1] & 0xF ) << 8 | entry[0]);
+	if ( !visited[left] ) {
+		pairs.m_SymbolLengths[left] = SetSymbolLength( pairs, left, visited );
+	}
+	if ( !visited[right] ) {
+		pairs.m_SymbolLengths[right] = SetSymbolLength( pairs, right, visited );
+	}
+
+	return static_cast<uint8_t>(pairs.m_SymbolLengths[left] + pairs.m_SymbolLengths[right] + 1);
+}
+
+static const uint8_t* SetSizes( PairsData &pairs, const uint8_t *data ) {
+	pairs.m_Flags = *data++;
+
+	// The whole subtable holds one value, kept in place of the symbol length.
+	if ( pairs.m_Flags & FLAG_SINGLE_VALUE ) {
+		pairs.m_MinSymbolLength = *data++;
+		return data;
+	}
+
+	const uint8_t *groupEnd = std::find( pairs.m_GroupLength, pairs.m_GroupLength + SYZYGY_MAX_PIECES, 0 );
+	const uint64_t tableSize = pairs.m_GroupIndex[groupEnd - pairs.m_GroupLength];
+
+	pairs.m_BlockSize = 1ull << *data++;
+	pairs.m_Span = 1ull << *data++;
+	pairs.m_SparseIndexCount = ( tableSize + pairs.m_Span - 1 ) / pairs.m_Span;
+	const uint8_t padding = *data++;
+	pairs.m_BlockCount = ReadLittleEndian32( data );
+	data += 4;
+	pairs.m_BlockLengthCount = pairs.m_BlockCount + padding;
+	pairs.m_MaxSymbolLength = *data++;
+	pairs.m_MinSymbolLength = *data++;
+	pairs.m_LowestSymbols = data;
+
+	// Canonical Huffman codes: longer codes have lower values, so the lowest code of each length padded to 64 bits gives
+	// decreasing bounds to find a code's length by.
+	const size_t lengths = pairs.m_MaxSymbolLength - pairs.m_MinSymbolLength + 1;
+	pairs.m_Base.assign( lengths, 0 );
+	for ( int32_t i = static_cast<int32_t>(lengths) - 2; i >= 0; i-- ) {
+		pairs.m_Base[i] = ( pairs.m_Base[i + 1] + ReadLittleEndian16( pairs.m_LowestSymbols + 2 * i ) -
+		                    ReadLittleEndian16( pairs.m_LowestSymbols + 2 * ( i + 1 ) ) ) / 2;
+	}
+	for ( size_t i = 0; i < lengths; i++ ) {
+		pairs.m_Base[i] <<= 64 - i - pairs.m_MinSymbolLength;
+	}
+
+	data += 2 * lengths;
+	pairs.m_SymbolLengths.assign( ReadLittleEndian16( data ), 0 );
+	data += 2;
+	pairs.m_SymbolTree = data;
+
+	std::vector<bool> visited( pairs.m_SymbolLengths.size() );
+	for ( uint16_t symbol = 0; symbol < pairs.m_SymbolLengths.size(); symbol++ ) {
+		if ( !visited[symbol] ) {
+			pairs.m_SymbolLengths[symbol] = SetSymbolLength( pairs, symbol, visited );
+		}
+	}
+
+	return data + 3 * pairs.m_SymbolLengths.size() + ( pairs.m_SymbolLengths.size() & 1 );
+}
+
+// Groups are the pieces encoded together: the leading pawns or the first three unique pieces (the two kings when there
+// are none), then runs of identical pieces. The order byte tells in which order the groups make up the index.
+static void SetGroups( const SyzygyTable &table, PairsData &pairs, const uint8_t order[2], const uint32_t file ) {
+	int32_t firstLength = table.m_HasPawns ? 0 : table.m_HasUniquePieces ? 3 : 2;
+	uint32_t groups = 0;
+	pairs.m_GroupLength[0] = 1;
+	for ( uint32_t i = 1; i < table.m_PieceCount; i++ ) {
+		if ( --firstLength > 0 || pairs.m_Pieces[i] == pairs.m_Pieces[i - 1] ) {
+			pairs.m_GroupLength[groups]++;
+		} else {
+			pairs.m_GroupLength[++groups] = 1;
+		}
+	}
+	pairs.m_GroupLength[++groups] = 0;
+
+	const bool pawnsOnBothSides = table.m_HasPawns && table.m_PawnCount[1] > 0;
+	uint32_t next = pawnsOnBothSides ? 2 : 1;
+	uint32_t freeSquares = 64 - pairs.m_GroupLength[0] - ( pawnsOnBothSides ? pairs.m_GroupLength[1] : 0 );
+	uint64_t index = 1;
+
+	for ( uint32_t k = 0; next < groups || k == order[0] || k == order[1]; k++ ) {
+		if ( k == order[0] ) {
+			pairs.m_GroupIndex[0] = index;
+			index *= table.m_HasPawns
+				         ? s_Index.m_LeadPawnsSize[pairs.m_GroupLength[0]][file]
+				         : table.m_HasUniquePieces
+				         ? 31332
+				         : 462;
+		} else if ( k == order[1] ) {
+			pairs.m_GroupIndex[1] = index;
+			index *= s_Index.m_Binomial[pairs.m_GroupLength[1]][48 - pairs.m_GroupLength[0]];
+		} else {
+			pairs.m_GroupIndex[next] = index;
+			index *= s_Index.m_Binomial[pairs.m_GroupLength[next]][freeSquares];
+			freeSquares -= pairs.m_GroupLength[next++];
+		}
+	}
+
+	pairs.m_GroupIndex[groups] = index;
+}
+
+// DTZ values are stored as ranks by frequency for each result; these maps turn them back into distances.
+static const uint8_t* SetDtzMap( SyzygyTable &table, const uint8_t *data, const uint32_t files ) {
+	table.m_DtzMap = data;
+
+	for ( uint32_t file = 0; file < files; file++ ) {
+		PairsData &pairs = table.Get( 0, file );
+		if ( !( pairs.m_Flags & FLAG_MAPPED ) ) {
+			continue;
+		}
+
+		if ( pairs.m_Flags & FLAG_WIDE ) {
+			data += reinterpret_cast<uintptr_t>(data) & 1;
+			for ( uint32_t &offset : pairs.m_MapOffsets ) {
+				offset = static_cast<uint32_t>(data - table.m_DtzMap + 2);
+				data += 2 * ReadLittleEndian16( data ) + 2;
+			}
+		} else {
+			for ( uint32_t &offset : pairs.m_MapOffsets ) {
+				offset = static_cast<uint32_t>(data - table.m_DtzMap + 1);
+				data += *data + 1;
+			}
+		}
+	}
+
+	return data + ( reinterpret_cast<uintptr_t>(data) & 1 );
+}
+
+static bool ParseTable( SyzygyTable &table, const uint8_t *data ) {
+	const uint8_t *end = data + table.m_File.GetSize();
+	data += 4;
+
+	// The first byte repeats what the file name says. Only WDL tables are split by side to move.
+	const bool split = *data & 1;
+	const bool hasPawns = *data & 2;
+	if ( hasPawns != table.m_HasPawns || ( !table.m_IsDtz && split != ( table.m_Key != table.m_Key2 ) ) ) {
+		return false;
+	}
+	data++;
+
+	const uint32_t sides = !table.m_IsDtz && table.m_Key != table.m_Key2 ? 2 : 1;
+	const uint32_t files = table.m_HasPawns ? 4 : 1;
+	const bool pawnsOnBothSides = table.m_HasPawns && table.m_PawnCount[1] > 0;
+
+	for ( uint32_t file = 0; file < files; file++ ) {
+		const uint8_t order[2][2]{
+			{ static_cast<uint8_t>(*data & 0xF), static_cast<uint8_t>(pawnsOnBothSides ? data[1] & 0xF : 0xF) },
+			{ static_cast<uint8_t>(*data >> 4), static_cast<uint8_t>(pawnsOnBothSides ? data[1] >> 4 : 0xF) },
+		};
+		data += 1 + pawnsOnBothSides;
+
+		for ( uint32_t k = 0; k < table.m_PieceCount; k++, data++ ) {
+			for ( uint32_t side = 0; side < sides; side++ ) {
+				table.Get( side, file ).m_Pieces[k] = side ? *data >> 4 : *data & 0xF;
+			}
+		}
+
+		for ( uint32_t side = 0; side < sides; side++ ) {
+			SetGroups( table, table.Get( side, file ), order[side], file );
+		}
+	}
+
+	data += reinterpret_cast<uintptr_t>(data) & 1;
+
+	for ( uint32_t file = 0; file < files; file++ ) {
+		for ( uint32_t side = 0; side < sides; side++ ) {
+			data = SetSizes( table.Get( side, file ), data );
+		}
+	}
+
+	if ( table.m_IsDtz ) {
+		data = SetDtzMap( table, data, files );
+	}
+
+	for ( uint32_t file = 0; file < files; file++ ) {
+		for ( uint32_t side = 0; side < sides; side++ ) {
+			PairsData &pairs = table.Get( side, file );
+			pairs.m_SparseIndex = data;
+			data += 6 * pairs.m_SparseIndexCount;
+		}
+	}
+
+	for ( uint32_t file = 0; file < files; file++ ) {
+		for ( uint32_t side = 0; side < sides; side++ ) {
+			PairsData &pairs = table.Get( side, file );
+			pairs.m_BlockLengths = data;
+			data += 2 * static_cast<uint64_t>(pairs.m_BlockLengthCount);
+		}
+	}
+
+	for ( uint32_t file = 0; file < files; file++ ) {
+		for ( uint32_t side = 0; side < sides; side++ ) {
+			data = reinterpret_cast<const uint8_t*>(( reinterpret_cast<uintptr_t>(data) + 63 ) & ~static_cast<uintptr_t>(63));
+			PairsData &pairs = table.Get( side, file );
+			pairs.m_Data = data;
+			data += pairs.m_BlockCount * pairs.m_BlockSize;
+		}
+	}
+
+	// A truncated file would otherwise be read past its end.
+	return data <= end;
+}
+
+// Double-checked, so tables already mapped cost a single atomic load.
+static bool EnsureMapped( SyzygyTable &table ) {
+	if ( table.m_Ready.load( std::memory_order_acquire ) ) {
+		return table.m_Valid;
+	}
+
+	std::lock_guard lock( s_MappingMutex );
+	if ( table.m_Ready.load( std::memory_order_relaxed ) ) {
+		return table.m_Valid;
+	}
+
+	const uint8_t *magic = table.m_IsDtz ? DTZ_MAGIC : WDL_MAGIC;
+	table.m_Valid = table.m_File.Open( table.m_Path ) && table.m_File.GetSize() > 16 &&
+	                std::equal( magic, magic + 4, table.m_File.GetData() ) &&
+	                ParseTable( table, table.m_File.GetData() );
+	if ( !table.m_Valid ) {
+		table.m_File.Close();
+	}
+
+	table.m_Ready.store( true, std::memory_order_release );
+	return table.m_Valid;
+}
+
+// Finds the value at index by walking the blocks from the nearest sparse index entry, then decoding the block's
+// Huffman codes until the one covering the index and expanding its symbol pairs down to a single value.
+static int32_t Decompress( const PairsData &pairs, const uint64_t index ) {
+	if ( pairs.m_Flags & FLAG_SINGLE_VALUE ) {
+		return pairs.m_MinSymbolLength;
+	}
+
+	const uint64_t k = index / pairs.m_Span;
+	uint32_t block = ReadLittleEndian32( pairs.m_SparseIndex + 6 * k );
+	int32_t offset = ReadLittleEndian16( pairs.m_SparseIndex + 6 * k + 4 );
+	offset += static_cast<int32_t>(index % pairs.m_Span) - static_cast<int32_t>(pairs.m_Span / 2);
+
+	while ( offset < 0 ) {
+		offset += ReadLittleEndian16( pairs.m_BlockLengths + 2 * --block ) + 1;
+	}
+	while ( offset > ReadLittleEndian16( pairs.m_BlockLengths + 2 * block ) ) {
+		offset -= ReadLittleEndian16( pairs.m_BlockLengths + 2 * block++ ) + 1;
+	}
+
+	const uint8_t *pointer = pairs.m_Data + static_cast<uint64_t>(block) * pairs.m_BlockSize;
+	uint64_t buffer = ReadBigEndian64( pointer );
+	pointer += 8;
+	int32_t bufferSize = 64;
+
+	uint16_t symbol;
+	while ( true ) {
+		uint32_t length = 0;
+		while ( buffer < pairs.m_Base[length] ) {
+			length++;
+		}
+
+		symbol = static_cast<uint16_t>(( buffer - pairs.m_Base[length] ) >> ( 64 - length - pairs.m_MinSymbolLength ));
+		symbol += ReadLittleEndian16( pairs.m_LowestSymbols + 2 * length );
+
+		if ( offset < pairs.m_SymbolLengths[symbol] + 1 ) {
+			break;
+		}
+
+		offset -= pairs.m_SymbolLengths[symbol] + 1;
+		length += pairs.m_MinSymbolLength;
+		buffer <<= length;
+		bufferSize -= static_cast<int32_t>(length);
+
+		if ( bufferSize <= 32 ) {
+			bufferSize += 32;
+			buffer |= static_cast<uint64_t>(ReadBigEndian32( pointer )) << ( 64 - bufferSize );
+			pointer += 4;
+		}
+	}
+
+	while ( pairs.m_SymbolLengths[symbol] ) {
+		const uint8_t *entry = pairs.m_SymbolTree + 3 * symbol;
+		const uint16_t left = static_cast<uint16_t>(( entry[1] & 0xF ) << 8 | entry[0]);
+		if ( offset < pairs.m_SymbolLengths[left] + 1 ) {
+			symbol = left;
+		} else {
+			offset -= pairs.m_SymbolLengths[left] + 1;
+			symbol = static_cast<uint16_t>(entry[2] << 4 | entry[1] >> 4);
+		}
+	}
+
+	const uint8_t *entry = pairs.m_SymbolTree + 3 * symbol;
+	return ( entry[1] & 0xF ) << 8 | entry[0];
+}
+
+static int32_t MapScore( SyzygyTable &table, const uint32_t file, int32_t value, const WdlScore wdl ) {
+	if ( !table.m_IsDtz ) {
+		return value - 2;
+	}
+
+	// Map sections are stored as win, loss, cursed win, blessed loss.
+	static constexpr uint32_t SECTIONS[5]{ 1, 3, 0, 2, 0 };
+
+	const PairsData &pairs = table.Get( 0, file );
+	if ( pairs.m_Flags & FLAG_MAPPED ) {
+		const uint32_t offset = pairs.m_MapOffsets[SECTIONS[static_cast<int32_t>(wdl) + 2]];
+		value = pairs.m_Flags & FLAG_WIDE
+			        ? ReadLittleEndian16( table.m_DtzMap + offset + 2 * value )
+			        : table.m_DtzMap[offset + value];
+	}
+
+	// Stored in moves unless the flags say plies.
+	if ( ( wdl == WdlScore::WIN && !( pairs.m_Flags & FLAG_WIN_PLIES ) ) ||
+	     ( wdl == WdlScore::LOSS && !( pairs.m_Flags & FLAG_LOSS_PLIES ) ) || wdl == WdlScore::CURSED_WIN ||
+	     wdl == WdlScore::BLESSED_LOSS ) {
+		value *= 2;
+	}
+
+	return value + 1;
+}
+
+// Maps the position to its index in the table and reads the value stored there. Tables are stored with the first side
+// of their name as white, so a position with the colors the other way around is looked up mirrored.
+static int32_t ProbeTable( const Board &board, SyzygyTable &table, const WdlScore wdl, ProbeState &state ) {
+	const SideToMove side = board.GetSideToMove();
+	const bool symmetricBlackToMove = table.m_Key == table.m_Key2 && side == BLACK;
+	const bool blackStronger = GetMaterialKey( board ) != table.m_Key;
+	const bool flip = symmetricBlackToMove || blackStronger;
+	const uint8_t flipColor = flip ? BLACK_PIECE : 0;
+	const uint8_t flipSquares = flip ? 56 : 0;
+	const uint32_t stm = ( flip ? 1 : 0 ) ^ side;
+
+	uint8_t squares[SYZYGY_MAX_PIECES];
+	uint8_t pieces[SYZYGY_MAX_PIECES];
+	uint32_t size = 0;
+	uint32_t leadPawnCount = 0;
+	uint32_t file = 0;
+	Bitboard leadPawns = 0;
+
+	const auto byPawnMap = []( const uint8_t a, const uint8_t b ) {
+		return s_Index.m_MapPawns[a] < s_Index.m_MapPawns[b];
+	};
+
+	// The leading pawns come first and decide which of the four per-file subtables holds the position.
+	if ( table.m_HasPawns ) {
+		const uint8_t leadPiece = table.Get( 0, 0 ).m_Pieces[0] ^ flipColor;
+		leadPawns = board.GetPieceMask( PAWN, leadPiece & BLACK_PIECE ? BLACK : WHITE );
+		leadPawns.Map( [&]( const Square square ) {
+			squares[size++] = square ^ flipSquares;
+		} );
+		leadPawnCount = size;
+
+		std::swap( squares[0], *std::max_element( squares, squares + leadPawnCount, byPawnMap ) );
+		file = std::min<uint32_t>( squares[0] % 8, 7 - squares[0] % 8 );
+	}
+
+	// DTZ tables only store one side to move.
+	if ( table.m_IsDtz ) {
+		const PairsData &pairs = table.Get( 0, file );
+		if ( ( pairs.m_Flags & FLAG_STM ) != stm && ( table.m_Key != table.m_Key2 || !table.m_HasPawns ) ) {
+			state = ProbeState::CHANGE_STM;
+			return 0;
+		}
+	}
+
+	( board.GetOccupancy() & ~leadPawns ).Map( [&]( const Square square ) {
+		squares[size] = square ^ flipSquares;
+		pieces[size++] = GetTablePiece( board, square ) ^ flipColor;
+	} );
+
+	PairsData &pairs = table.Get( stm, file );
+
+	// Put the pieces in the order the table lists them.
+	for ( uint32_t i = leadPawnCount; i + 1 < size; i++ ) {
+		for ( uint32_t j = i + 1; j < size; j++ ) {
+			if ( pairs.m_Pieces[i] == pieces[j] ) {
+				std::swap( pieces[i], pieces[j] );
+				std::swap( squares[i], squares[j] );
+				break;
+			}
+		}
+	}
+
+	// Mirror so the leading piece is on files a to d.
+	if ( squares[0] % 8 > 3 ) {
+		for ( uint32_t i = 0; i < size; i++ ) {
+			squares[i] ^= 7;
+		}
+	}
+
+	uint64_t index;
+	if ( table.m_HasPawns ) {
+		index = s_Index.m_LeadPawnIndex[leadPawnCount][squares[0]];
+		std::stable_sort( squares + 1, squares + leadPawnCount, byPawnMap );
+		for ( uint32_t i = 1; i < leadPawnCount; i++ ) {
+			index += s_Index.m_Binomial[i][s_Index.m_MapPawns[squares[i]]];
+		}
+	} else {
+		// Without pawns the board is also mirrored to put the leading piece on ranks 1 to 4, then across the a1-h8
+		// diagonal so the first leading piece off it is below.
+		if ( squares[0] / 8 > 3 ) {
+			for ( uint32_t i = 0; i < size; i++ ) {
+				squares[i] ^= 56;
+			}
+		}
+
+		for ( uint32_t i = 0; i < pairs.m_GroupLength[0]; i++ ) {
+			if ( GetDiagonalOffset( squares[i] ) == 0 ) {
+				continue;
+			}
+
+			if ( GetDiagonalOffset( squares[i] ) > 0 ) {
+				for ( uint32_t j = i; j < size; j++ ) {
+					squares[j] = static_cast<uint8_t>(( squares[j] >> 3 | squares[j] << 3 ) & 63);
+				}
+			}
+			break;
+		}
+
+		if ( table.m_HasUniquePieces ) {
+			const int32_t adjust1 = squares[1] > squares[0];
+			const int32_t adjust2 = ( squares[2] > squares[0] ) + ( squares[2] > squares[1] );
+
+			if ( GetDiagonalOffset( squares[0] ) ) {
+				index = ( s_Index.m_MapA1D1D4[squares[0]] * 63 + ( squares[1] - adjust1 ) ) * 62 + squares[2] - adjust2;
+			} else if ( GetDiagonalOffset( squares[1] ) ) {
+				index = ( 6 * 63 + squares[0] / 8 * 28 + s_Index.m_MapB1H1H7[squares[1]] ) * 62 + squares[2] - adjust2;
+			} else if ( GetDiagonalOffset( squares[2] ) ) {
+				index = 6 * 63 * 62 + 4 * 28 * 62 + squares[0] / 8 * 7 * 28 + ( squares[1] / 8 - adjust1 ) * 28 +
+				        s_Index.m_MapB1H1H7[squares[2]];
+			} else {
+				index = 6 * 63 * 62 + 4 * 28 * 62 + 4 * 7 * 28 + squares[0] / 8 * 7 * 6 + ( squares[1] / 8 - adjust1 ) * 6 +
+				        ( squares[2] / 8 - adjust2 );
+			}
+		} else {
+			index = s_Index.m_MapKK[s_Index.m_MapA1D1D4[squares[0]]][squares[1]];
+		}
+	}
+
+	index *= pairs.m_GroupIndex[0];
+
+	// The other groups, each as a combination of the squares left free by the groups before it.
+	uint8_t *groupSquares = squares + pairs.m_GroupLength[0];
+	bool remainingPawns = table.m_HasPawns && table.m_PawnCount[1] > 0;
+	for ( uint32_t next = 1; pairs.m_GroupLength[next]; next++ ) {
+		std::stable_sort( groupSquares, groupSquares + pairs.m_GroupLength[next] );
+
+		uint64_t groupIndex = 0;
+		for ( uint32_t i = 0; i < pairs.m_GroupLength[next]; i++ ) {
+			const auto adjust = std::count_if( squares, groupSquares, [&]( const uint8_t square ) {
+				return groupSquares[i] > square;
+			} );
+			groupIndex += s_Index.m_Binomial[i + 1][groupSquares[i] - adjust - 8 * remainingPawns];
+		}
+
+		remainingPawns = false;
+		index += groupIndex * pairs.m_GroupIndex[next];
+		groupSquares += pairs.m_GroupLength[next];
+	}
+
+	return MapScore( table, file, Decompress( pairs, index ), wdl );
+}
+
+static int32_t ProbeTable( const Board &board, const bool dtz, const WdlScore wdl, ProbeState &state ) {
+	// Bare kings have no table.
+	if ( board.GetOccupancy().PopCount() == 2 ) {
+		return 0;
+	}
+
+	const auto it = s_TableMap.find( GetMaterialKey( board ) );
+	if ( it == s_TableMap.end() ) {
+		state = ProbeState::FAIL;
+		return 0;
+	}
+
+	SyzygyTable &table = dtz ? it->second->m_Dtz : it->second->m_Wdl;
+	if ( table.m_Path.empty() || !EnsureMapped( table ) ) {
+		state = ProbeState::FAIL;
+		return 0;
+	}
+
+	return ProbeTable( board, table, wdl, state );
+}
+
+static bool IsZeroing( const Board &board, const Move move ) {
+	return move.IsCapture() || board.GetPieceOnSquare( move.GetFromSquare() ) == PAWN;
+}
+
+static uint8_t GenerateLegalMoves( const Board &board, Move *moves ) {
+	return MoveGenerator( board, board.GenerateCastleMask() ).GenerateMoves<MoveGenMode::ALL>( moves );
+}
+
+static WdlScore Negate( const WdlScore score ) {
+	return static_cast<WdlScore>(-static_cast<int8_t>(score));
+}
+
+// The tables may hold any value where the side to move has a winning capture, as the capture is found anyway, and may
+// store a loss instead of a draw reached by capturing. So captures are always tried as well, and pawn moves too when
+// the result feeds a DTZ probe, whose tables hold nothing for zeroing moves. The better result counts.
+template<bool CHECK_ZEROING>
+static WdlScore SearchWdl( const Board &board, ProbeState &state ) {
+	Move moves[MAX_MOVES];
+	const uint8_t count = GenerateLegalMoves( board, moves );
+
+	WdlScore bestScore = WdlScore::LOSS;
+	uint8_t zeroingCount = 0;
+	for ( uint8_t i = 0; i < count; i++ ) {
+		if ( !moves[i].IsCapture() && ( !CHECK_ZEROING || board.GetPieceOnSquare( moves[i].GetFromSquare() ) != PAWN ) ) {
+			continue;
+		}
+
+		zeroingCount++;
+		Board child = board;
+		child.MakeMove( moves[i], board.GenerateCastleMask() );
+		const WdlScore score = Negate( SearchWdl<false>( child, state ) );
+		if ( state == ProbeState::FAIL ) {
+			return WdlScore::DRAW;
+		}
+
+		if ( score > bestScore ) {
+			bestScore = score;
+			if ( score >= WdlScore::WIN ) {
+				state = ProbeState::ZEROING_BEST_MOVE;
+				return score;
+			}
+		}
+	}
+
+	// With every move already tried the stored value is not needed, and may be wrong, as with en passant rights.
+	const bool noMoreMoves = zeroingCount > 0 && zeroingCount == count;
+
+	WdlScore score;
+	if ( noMoreMoves ) {
+		score = bestScore;
+	} else {
+		score = static_cast<WdlScore>(ProbeTable( board, false, WdlScore::DRAW, state ));
+		if ( state == ProbeState::FAIL ) {
+			return WdlScore::DRAW;
+		}
+	}
+
+	if ( bestScore >= score ) {
+		state = bestScore > WdlScore::DRAW || noMoreMoves ? ProbeState::ZEROING_BEST_MOVE : ProbeState::OK;
+		return bestScore;
+	}
+
+	state = ProbeState::OK;
+	return score;
+}
+
+// The distance before a capture or pawn move that leads to the given result.
+static int32_t GetDtzBeforeZeroing( const WdlScore score ) {
+	switch ( score ) {
+		case WdlScore::WIN: return 1;
+		case WdlScore::CURSED_WIN: return 101;
+		case WdlScore::BLESSED_LOSS: return -101;
+		case WdlScore::LOSS: return -1;
+		default: return 0;
+	}
+}
+
+static int32_t ProbeDtzInternal( const Board &board, ProbeState &state ) {
+	state = ProbeState::OK;
+	const WdlScore wdl = SearchWdl<true>( board, state );
+	if ( state == ProbeState::FAIL || wdl == WdlScore::DRAW ) {
+		return 0;
+	}
+
+	if ( state == ProbeState::ZEROING_BEST_MOVE ) {
+		return GetDtzBeforeZeroing( wdl );
+	}
+
+	const int32_t sign = wdl > WdlScore::DRAW ? 1 : -1;
+	int32_t dtz = ProbeTable( board, true, wdl, state );
+	if ( state == ProbeState::FAIL ) {
+		return 0;
+	}
+
+	if ( state != ProbeState::CHANGE_STM ) {
+		return ( dtz + 100 * ( wdl == WdlScore::BLESSED_LOSS || wdl == WdlScore::CURSED_WIN ) ) * sign;
+	}
+
+	// The table holds the other side to move, so take the best of the children.
+	Move moves[MAX_MOVES];
+	const uint8_t count = GenerateLegalMoves( board, moves );
+	int32_t minDtz = 0xFFFF;
+	for ( uint8_t i = 0; i < count; i++ ) {
+		const bool zeroing = IsZeroing( board, moves[i] );
+		Board child = board;
+		child.MakeMove( moves[i], board.GenerateCastleMask() );
+
+		if ( zeroing ) {
+			dtz = -GetDtzBeforeZeroing( SearchWdl<false>( child, state ) );
+		} else {
+			dtz = -ProbeDtzInternal( child, state );
+		}
+
+		// A mate is as short as it gets.
+		Move replies[MAX_MOVES];
+		if ( dtz == 1 && Attacks::IsInCheck( child ) && GenerateLegalMoves( child, replies ) == 0 ) {
+			minDtz = 1;
+		}
+
+		if ( !zeroing ) {
+			dtz += dtz > 0 ? 1 : dtz < 0 ? -1 : 0;
+		}
+
+		if ( dtz < minDtz && ( dtz > 0 ? 1 : dtz < 0 ? -1 : 0 ) == sign ) {
+			minDtz = dtz;
+		}
+
+		if ( state == ProbeState::FAIL ) {
+			return 0;
+		}
+	}
+
+	return minDtz == 0xFFFF ? -1 : minDtz;
+}
+
+uint32_t Syzygy::Init( const std::string &paths ) {
+	Free();
+
+	std::vector<std::filesystem::path> directories;
+	for ( size_t start = 0; start <= paths.size(); ) {
+		const size_t end = std::min( paths.find( PATH_SEPARATOR, start ), paths.size() );
+		if ( end > start ) {
+			directories.emplace_back( paths.substr( start, end - start ) );
+		}
+		start = end + 1;
+	}
+
+	// Sorted, so the same directories always give the same tables whatever order the system lists them in.
+	std::map<std::string, std::string> wdlPaths;
+	std::map<std::string, std::string> dtzPaths;
+	for ( const auto &directory : directories ) {
+		std::error_code error;
+		for ( const auto &file : std::filesystem::directory_iterator( directory, error ) ) {
+			const std::string extension = file.path().extension().string();
+			auto &found = extension == ".rtbw" ? wdlPaths : dtzPaths;
+			if ( extension == ".rtbw" || extension == ".rtbz" ) {
+				found.emplace( file.path().stem().string(), file.path().string() );
+			}
+		}
+	}
+
+	for ( const auto &[name, path] : wdlPaths ) {
+		uint8_t counts[2][5];
+		uint8_t pieceCount;
+		if ( !ParseTableName( name, counts, pieceCount ) ) {
+			continue;
+		}
+
+		auto tables = std::make_unique<TablePair>();
+		tables->m_Wdl.m_Path = path;
+		SetTableInfo( tables->m_Wdl, counts, pieceCount );
+
+		tables->m_Dtz.m_IsDtz = true;
+		if ( const auto dtz = dtzPaths.find( name ); dtz != dtzPaths.end() ) {
+			tables->m_Dtz.m_Path = dtz->second;
+		}
+		SetTableInfo( tables->m_Dtz, counts, pieceCount );
+
+		if ( !s_TableMap.contains( tables->m_Wdl.m_Key ) ) {
+			s_TableMap.emplace( tables->m_Wdl.m_Key, tables.get() );
+			s_TableMap.emplace( tables->m_Wdl.m_Key2, tables.get() );
+			s_MaxPieces = std::max( s_MaxPieces, pieceCount );
+			s_Tables.push_back( std::move( tables ) );
+		}
+	}
+
+	return static_cast<uint32_t>(s_Tables.size());
+}
+
+void Syzygy::Free() {
+	s_TableMap.clear();
+	s_Tables.clear();
+	s_MaxPieces = 0;
+}
+
+bool Syzygy::ProbeWdl( const Board &board, WdlScore &score ) {
+	s_WdlProbes.fetch_add( 1, std::memory_order_relaxed );
+
+	ProbeState state = ProbeState::OK;
+	score = SearchWdl<false>( board, state );
+	if ( state == ProbeState::FAIL ) {
+		return false;
+	}
+
+	s_WdlHits.fetch_add( 1, std::memory_order_relaxed );
+	return true;
+}
+
+bool Syzygy::ProbeDtz( const Board &board, int32_t &dtz ) {
+	s_DtzProbes.fetch_add( 1, std::memory_order_relaxed );
+
+	ProbeState state;
+	dtz = ProbeDtzInternal( board, state );
+	if ( state == ProbeState::FAIL ) {
+		return false;
+	}
+
+	s_DtzHits.fetch_add( 1, std::memory_order_relaxed );
+	return true;
+}
+
+// Each move is scored by the DTZ it leaves, counted from the root. Results the fifty-move counter already rules out are
+// ranked below the ones still reachable but above the opposite result. The whole call counts as a single DTZ probe.
+bool Syzygy::ProbeRoot( const Board &board, Move &move, WdlScore &score ) {
+	s_DtzProbes.fetch_add( 1, std::memory_order_relaxed );
+
+	Move moves[MAX_MOVES];
+	const uint8_t count = GenerateLegalMoves( board, moves );
+	if ( count == 0 ) {
+		return false;
+	}
+
+	const int32_t remaining = 100 - board.GetHalfMoves();
+	int32_t bestRank = -MAX_DTZ - 1;
+	int32_t bestDtz = 0;
+	for ( uint8_t i = 0; i < count; i++ ) {
+		Board child = board;
+		child.MakeMove( moves[i], board.GenerateCastleMask() );
+
+		ProbeState state = ProbeState::OK;
+		int32_t dtz;
+		if ( child.GetHalfMoves() == 0 ) {
+			const WdlScore childScore = SearchWdl<false>( child, state );
+			if ( state == ProbeState::FAIL ) {
+				return false;
+			}
+			dtz = GetDtzBeforeZeroing( Negate( childScore ) );
+		} else {
+			dtz = -ProbeDtzInternal( child, state );
+			if ( state == ProbeState::FAIL ) {
+				return false;
+			}
+			dtz += dtz > 0 ? 1 : dtz < 0 ? -1 : 0;
+		}
+
+		Move replies[MAX_MOVES];
+		if ( dtz == 2 && Attacks::IsInCheck( child ) && GenerateLegalMoves( child, replies ) == 0 ) {
+			dtz = 1;
+		}
+
+		const int32_t rank = dtz > 0
+			                     ? ( dtz <= remaining ? MAX_DTZ - dtz : MAX_DTZ / 2 - dtz )
+			                     : dtz < 0
+			                     ? ( -dtz <= remaining ? -MAX_DTZ - dtz : -MAX_DTZ / 2 - dtz )
+			                     : 0;
+		if ( rank > bestRank ) {
+			bestRank = rank;
+			bestDtz = dtz;
+			move = moves[i];
+		}
+	}
+
+	score = bestDtz > 0
+		        ? ( bestDtz <= remaining ? WdlScore::WIN : WdlScore::CURSED_WIN )
+		        : bestDtz < 0
+		        ? ( -bestDtz <= remaining ? WdlScore::LOSS : WdlScore::BLESSED_LOSS )
+		        : WdlScore::DRAW;
+	s_DtzHits.fetch_add( 1, std::memory_order_relaxed );
+	return true;
+}
+
+SyzygyStats Syzygy::GetStats() {
+	return {
+		s_WdlProbes.load( std::memory_order_relaxed ),
+		s_WdlHits.load( std::memory_order_relaxed ),
+		s_DtzProbes.load( std::memory_order_relaxed ),
+		s_DtzHits.load( std::memory_order_relaxed ),
+	};
+}
+
+void Syzygy::ResetStats() {
+	s_WdlProbes.store( 0, std::memory_order_relaxed );
+	s_WdlHits.store( 0, std::memory_order_relaxed );
+	s_DtzProbes.store( 0, std::memory_order_relaxed );
+	s_DtzHits.store( 0, std::memory_order_relaxed );
+}
@@ -0,0 +1,119 @@
+#include "KitsuneEngine/thread_pool.h"
+
+static thread_local const ThreadPool *s_CurrentPool = nullptr;
+static thread_local uint32_t s_WorkerIndex = 0;
+
+ThreadPool::ThreadPool( const uint32_t threadCount ) {
+	const uint32_t count = threadCount > 0 ? threadCount : 1;
+
+	for ( uint32_t i = 0; i < count; i++ ) {
+		m_Queues.push_back( std::make_unique<WorkQueue>() );
+	}
+
+	for ( uint32_t i = 0; i < count; i++ ) {
+		m_Threads.emplace_back( [this, i] {
+			WorkerLoop( i );
+		} );
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard lock( m_SignalMutex );
+		m_Stopping = true;
+	}
+
+	m_WorkSignal.notify_all();
+	m_Threads.clear();
+}
+
+void ThreadPool::Submit( Task task ) {
+	uint32_t index;
+	if ( s_CurrentPool == this ) {
+		index = s_WorkerIndex;
+	} else {
+		index = m_NextQueue.fetch_add( 1, std::memory_order_relaxed ) % m_Queues.size();
+	}
+
+	m_PendingTasks.fetch_add( 1 );
+
+	{
+		std::lock_guard lock( m_Queues[index]->m_Mutex );
+		m_Queues[index]->m_Tasks.push_back( std::move( task ) );
+	}
+
+	m_QueuedTasks.fetch_add( 1 );
+
+	{
+		std::lock_guard lock( m_SignalMutex );
+	}
+
+	m_WorkSignal.notify_one();
+}
+
+void ThreadPool::Wait() {
+	std::unique_lock lock( m_SignalMutex );
+	m_DoneSignal.wait( lock, [this] {
+		return m_PendingTasks.load() == 0;
+	} );
+}
+
+void ThreadPool::WorkerLoop( const uint32_t index ) {
+	s_CurrentPool = this;
+	s_WorkerIndex = index;
+
+	while ( true ) {
+		if ( Task task; TryPop( index, task ) || TrySteal( index, task ) ) {
+			m_QueuedTasks.fetch_sub( 1 );
+			task();
+
+			if ( m_PendingTasks.fetch_sub( 1 ) == 1 ) {
+				std::lock_guard lock( m_SignalMutex );
+				m_DoneSignal.notify_all();
+			}
+
+			continue;
+		}
+
+		std::unique_lock lock( m_SignalMutex );
+		m_WorkSignal.wait( lock, [this] {
+			return m_Stopping || m_QueuedTasks.load() > 0;
+		} );
+
+		if ( m_Stopping && m_QueuedTasks.load() == 0 ) {
+			return;
+		}
+	}
+}
+
+bool ThreadPool::TryPop( const uint32_t index, Task &task ) {
+	WorkQueue &queue = *m_Queues[index];
+	std::lock_guard lock( queue.m_Mutex );
+
+	if ( queue.m_Tasks.empty() ) {
+		return false;
+	}
+
+	task = std::move( queue.m_Tasks.back() );
+	queue.m_Tasks.pop_back();
+	return true;
+}
+
+bool ThreadPool::TrySteal( const uint32_t index, Task &task ) {
+	const auto queueCount = static_cast<uint32_t>(m_Queues.size());
+
+	for ( uint32_t offset = 1; offset < queueCount; offset++ ) {
+		WorkQueue &queue = *m_Queues[( index + offset ) % queueCount];
+		std::lock_guard lock( queue.m_Mutex );
+
+		if ( queue.m_Tasks.empty() ) {
+			continue;
+		}
+
+		task = std::move( queue.m_Tasks.front() );
+		queue.m_Tasks.pop_front();
+		return true;
+	}
+
+	return false;
+}
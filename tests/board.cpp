@@ -0,0 +1,132 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/core/undo_stack.h"
+#include "KitsuneEngine/eval/evaluation.h"
+
+static const std::string POSITIONS[]{
+	"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+	"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+	"rnbqkb1r/ppppp1pp/7n/4Pp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+	"n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+	"bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/BQ1BNRKR w HFhf - 2 9",
+	"1rkb1rbn/p1pp1ppp/3np3/1p6/4qP2/3NB3/PPPPPRPP/QRKB3N w Bfb - 0 9",
+};
+
+static bool IsSameState( const Board &lhs, const Board &rhs ) {
+	for ( int piece = PAWN; piece <= KING; piece++ ) {
+		if ( lhs.GetPieceMask( static_cast<PieceType>(piece) ) != rhs.GetPieceMask( static_cast<PieceType>(piece) ) ) {
+			return false;
+		}
+	}
+
+	for ( uint8_t square = 0; square < 64; square++ ) {
+		if ( lhs.GetPieceOnSquare( square ) != rhs.GetPieceOnSquare( square ) ) {
+			return false;
+		}
+	}
+
+	return lhs.GetOccupancy( WHITE ) == rhs.GetOccupancy( WHITE ) && lhs.GetOccupancy( BLACK ) == rhs.GetOccupancy( BLACK ) &&
+	       lhs.GetHash() == rhs.GetHash() && lhs.GetPawnHash() == rhs.GetPawnHash() &&
+	       lhs.GetSideToMove() == rhs.GetSideToMove() && lhs.GetEnPassantSquare() == rhs.GetEnPassantSquare() &&
+	       lhs.GetHalfMoves() == rhs.GetHalfMoves() && lhs.GetPhase() == rhs.GetPhase() &&
+	       lhs.GetPsqtScore() == rhs.GetPsqtScore() && lhs.CanCastle( CASTLE_WHITE_KING ) == rhs.CanCastle( CASTLE_WHITE_KING ) &&
+	       lhs.CanCastle( CASTLE_WHITE_QUEEN ) == rhs.CanCastle( CASTLE_WHITE_QUEEN ) &&
+	       lhs.CanCastle( CASTLE_BLACK_KING ) == rhs.CanCastle( CASTLE_BLACK_KING ) &&
+	       lhs.CanCastle( CASTLE_BLACK_QUEEN ) == rhs.CanCastle( CASTLE_BLACK_QUEEN );
+}
+
+static bool CheckMakeUnmake( Board &board, const CastleMask &castleMask, const uint8_t depth, UndoStack &undoStack ) {
+	if ( depth == 0 ) {
+		return true;
+	}
+
+	Move moves[MAX_MOVES]{ };
+	const uint8_t movesCount = MoveGenerator( board, castleMask ).GenerateMoves<MoveGenMode::ALL>( moves );
+
+	for ( uint8_t i = 0; i < movesCount; i++ ) {
+		Board copy = board;
+		copy.MakeMove( moves[i], castleMask );
+
+		const Board before = board;
+		board.MakeMove( moves[i], castleMask, undoStack.Push() );
+
+		if ( !IsSameState( board, copy ) || board.GetHash() != board.ComputeHash() ||
+		     board.GetPawnHash() != board.ComputePawnHash() || board.GetPsqtScore() != board.ComputePsqtScore() ||
+		     !CheckMakeUnmake( board, castleMask, depth - 1, undoStack ) ) {
+			return false;
+		}
+
+		board.UnmakeMove( moves[i], undoStack.Pop() );
+
+		if ( !IsSameState( board, before ) ) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+TEST_CASE( "Make/Unmake", "[BoardTests]" ) {
+	for ( const auto &position : POSITIONS ) {
+		DYNAMIC_SECTION( position ) {
+			auto board = Board( FEN( position ) );
+			const auto castleMask = board.GenerateCastleMask();
+			UndoStack undoStack;
+			CHECK( CheckMakeUnmake( board, castleMask, 3, undoStack ) );
+			CHECK( undoStack.GetSize() == 0 );
+		}
+	}
+}
+
+TEST_CASE( "Incremental Hash", "[BoardTests]" ) {
+	CHECK( Board().GetHash() == Board( FEN( POSITIONS[0] ) ).GetHash() );
+
+	for ( const auto &position : POSITIONS ) {
+		DYNAMIC_SECTION( position ) {
+			const auto board = Board( FEN( position ) );
+			CHECK( board.GetHash() == board.ComputeHash() );
+			CHECK( board.GetPawnHash() == board.ComputePawnHash() );
+		}
+	}
+}
+
+TEST_CASE( "Incremental PSQT Score", "[BoardTests]" ) {
+	CHECK( Board().GetPsqtScore() == Board( FEN( POSITIONS[0] ) ).GetPsqtScore() );
+	CHECK( Evaluation::Evaluate( Board() ) == 0 );
+
+	for ( const auto &position : POSITIONS ) {
+		DYNAMIC_SECTION( position ) {
+			const auto board = Board( FEN( position ) );
+			CHECK( board.GetPsqtScore() == board.ComputePsqtScore() );
+		}
+	}
+}
+
+TEST_CASE( "Packed Scores", "[BoardTests]" ) {
+	for ( const int16_t middlegame : { -1200, -1, 0, 1, 950 } ) {
+		for ( const int16_t endgame : { -1200, -1, 0, 1, 950 } ) {
+			const PackedScore score = PackScore( middlegame, endgame ) + PackScore( -7, 3 ) - PackScore( 5, -9 );
+			CHECK( GetMiddlegameScore( score ) == middlegame - 12 );
+			CHECK( GetEndgameScore( score ) == endgame + 12 );
+		}
+	}
+}
+
+TEST_CASE( "Tapered Evaluation Is Symmetric", "[BoardTests]" ) {
+	// Each position next to its mirror with the colors swapped.
+	const std::pair<std::string, std::string> positions[]{
+		{ "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		  "r3k2r/pppbbppp/2n2q1P/1P2p3/3pn3/BN2PNP1/P1PPQPB1/R3K2R b KQkq - 0 1" },
+		{ "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1", "5n1n/4kPPP/8/8/8/8/pppK4/N1N5 w - - 0 1" },
+		{ "8/5bk1/8/2Pp4/8/1K6/8/8 w - d6 0 1", "8/8/1k6/8/2pP4/8/5BK1/8 b - d3 0 1" },
+	};
+
+	for ( const auto &[position, mirrored] : positions ) {
+		DYNAMIC_SECTION( position ) {
+			CHECK( Evaluation::Evaluate( Board( FEN( position ) ) ) == Evaluation::Evaluate( Board( FEN( mirrored ) ) ) );
+		}
+	}
+}
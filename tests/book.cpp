@@ -0,0 +1,171 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "KitsuneEngine/book/polyglot_book.h"
+#include "KitsuneEngine/book/polyglot_key.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+
+static std::string GetTempPath( const std::string &name ) {
+	return ( std::filesystem::temp_directory_path() / name ).string();
+}
+
+static Board PlayMoves( const std::vector<std::string> &moves ) {
+	Board board;
+	for ( const std::string &text : moves ) {
+		Move legalMoves[MAX_MOVES];
+		const CastleMask castleMask = board.GenerateCastleMask();
+		const uint8_t count = MoveGenerator( board, castleMask ).GenerateMoves<MoveGenMode::ALL>( legalMoves );
+
+		bool found = false;
+		for ( uint8_t i = 0; i < count && !found; i++ ) {
+			if ( legalMoves[i].ToString( false ) == text ) {
+				board.MakeMove( legalMoves[i], castleMask );
+				found = true;
+			}
+		}
+		REQUIRE( found );
+	}
+
+	return board;
+}
+
+static void WriteBook( const std::string &path, const std::vector<PolyglotEntry> &entries ) {
+	std::ofstream file( path, std::ios::binary | std::ios::trunc );
+	for ( const PolyglotEntry &entry : entries ) {
+		const auto write = [&file]( const uint64_t value, const int bytes ) {
+			for ( int i = bytes - 1; i >= 0; i-- ) {
+				file.put( static_cast<char>(value >> 8 * i & 0xFF) );
+			}
+		};
+		write( entry.m_Key, 8 );
+		write( entry.m_Move, 2 );
+		write( entry.m_Weight, 2 );
+		write( entry.m_Learn, 4 );
+	}
+}
+
+static uint16_t EncodeBookMove( const Square from, const Square to, const uint16_t promotion = 0 ) {
+	return static_cast<uint16_t>(promotion << 12 | from << 6 | to);
+}
+
+TEST_CASE( "Polyglot Key Vectors", "[BookTests]" ) {
+	const std::pair<std::vector<std::string>, uint64_t> cases[]{
+		{ { }, 0x463B96181691FC9C },
+		{ { "e2e4" }, 0x823C9B50FD114196 },
+		{ { "e2e4", "d7d5" }, 0x0756B94461C50FB0 },
+		{ { "e2e4", "d7d5", "e4e5" }, 0x662FAFB965DB29D4 },
+		{ { "e2e4", "d7d5", "e4e5", "f7f5" }, 0x22A48B5A8E47FF78 },
+		{ { "e2e4", "d7d5", "e4e5", "f7f5", "e1e2" }, 0x652A607CA3F242C1 },
+		{ { "e2e4", "d7d5", "e4e5", "f7f5", "e1e2", "e8f7" }, 0x00FDD303C946BDD9 },
+		{ { "a2a4", "b7b5", "h2h4", "b5b4", "c2c4" }, 0x3C8123EA7B067637 },
+		{ { "a2a4", "b7b5", "h2h4", "b5b4", "c2c4", "b4c3", "a1a3" }, 0x5C3F9B829B279560 },
+	};
+
+	for ( const auto &[moves, key] : cases ) {
+		CHECK( PolyglotKey::Compute( PlayMoves( moves ) ) == key );
+	}
+}
+
+TEST_CASE( "Polyglot Key Properties", "[BookTests]" ) {
+	SECTION( "Transpositions share a key" ) {
+		CHECK( PolyglotKey::Compute( PlayMoves( { "g1f3", "g8f6", "f3g1", "f6g8" } ) ) == POLYGLOT_START_KEY );
+		CHECK( PolyglotKey::Compute( PlayMoves( { "e2e4", "e7e5", "g1f3" } ) ) ==
+		       PolyglotKey::Compute( PlayMoves( { "g1f3", "e7e5", "e2e4" } ) ) );
+	}
+
+	SECTION( "En passant only counts when a capture is possible" ) {
+		const auto withoutCapture = Board( FEN( "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1" ) );
+		const auto withoutSquare = Board( FEN( "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1" ) );
+		CHECK( PolyglotKey::Compute( withoutCapture ) == PolyglotKey::Compute( withoutSquare ) );
+
+		const auto withCapture = Board( FEN( "rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1" ) );
+		const auto withCaptureNoSquare = Board( FEN( "rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1" ) );
+		CHECK( PolyglotKey::Compute( withCapture ) != PolyglotKey::Compute( withCaptureNoSquare ) );
+	}
+}
+
+TEST_CASE( "Polyglot Book Lookup", "[BookTests]" ) {
+	const std::string path = GetTempPath( "kitsune_test_book.bin" );
+
+	std::vector<PolyglotEntry> entries;
+	for ( uint64_t key = 10; key <= 1000; key += 10 ) {
+		for ( uint16_t i = 0; i < key % 3 + 1; i++ ) {
+			entries.push_back( { key, static_cast<uint16_t>(key + i), static_cast<uint16_t>(i + 1), 0xDEADBEEF } );
+		}
+	}
+	WriteBook( path, entries );
+
+	PolyglotBook book;
+	REQUIRE( book.Open( path ) );
+	REQUIRE( book.GetEntryCount() == entries.size() );
+
+	const PolyglotEntry entry = book.GetEntry( 1 );
+	CHECK( entry.m_Key == entries[1].m_Key );
+	CHECK( entry.m_Move == entries[1].m_Move );
+	CHECK( entry.m_Weight == entries[1].m_Weight );
+	CHECK( entry.m_Learn == 0xDEADBEEF );
+
+	for ( uint64_t key = 0; key <= 1010; key += 5 ) {
+		const auto [first, last] = book.FindEntries( key );
+		const uint64_t expectedCount = key % 10 == 0 && key >= 10 && key <= 1000 ? key % 3 + 1 : 0;
+		REQUIRE( last - first == expectedCount );
+		for ( uint64_t i = first; i < last; i++ ) {
+			CHECK( book.GetEntry( i ).m_Key == key );
+		}
+	}
+
+	book.Close();
+	CHECK( !book.IsOpen() );
+	CHECK( book.Probe( Board(), 10, 0 ) == Move() );
+
+	// Not a whole number of entries.
+	std::ofstream( path, std::ios::binary | std::ios::app ).put( 0 );
+	CHECK( !book.Open( path ) );
+	CHECK( !book.Open( GetTempPath( "kitsune_missing_book.bin" ) ) );
+
+	std::filesystem::remove( path );
+}
+
+TEST_CASE( "Polyglot Book Probe", "[BookTests]" ) {
+	const std::string path = GetTempPath( "kitsune_test_probe.bin" );
+	constexpr uint64_t START_KEY = 1;
+	constexpr uint64_t CASTLE_KEY = 2;
+	constexpr uint64_t PROMOTION_KEY = 3;
+
+	WriteBook( path, {
+		           { START_KEY, EncodeBookMove( 12, 28 ), 3, 0 },
+		           { START_KEY, EncodeBookMove( 12, 36 ), 100, 0 },
+		           { START_KEY, EncodeBookMove( 6, 21 ), 0, 0 },
+		           { START_KEY, EncodeBookMove( 11, 27 ), 1, 0 },
+		           { CASTLE_KEY, EncodeBookMove( 4, 7 ), 1, 0 },
+		           { PROMOTION_KEY, EncodeBookMove( 48, 56, 2 ), 1, 0 },
+	           } );
+
+	PolyglotBook book;
+	REQUIRE( book.Open( path ) );
+
+	SECTION( "Weights decide the choice and illegal entries are skipped" ) {
+		const Board board;
+		for ( uint64_t random = 0; random < 8; random++ ) {
+			CHECK( book.Probe( board, START_KEY, random ).ToString( false ) == ( random % 4 < 3 ? "e2e4" : "d2d4" ) );
+		}
+		CHECK( book.Probe( board, 4, 0 ) == Move() );
+	}
+
+	SECTION( "Castling and promotions" ) {
+		const auto castleBoard = Board( FEN( "4k3/8/8/8/8/8/8/4K2R w K - 0 1" ) );
+		const Move castle = book.Probe( castleBoard, CASTLE_KEY, 0 );
+		CHECK( castle.IsCastle() );
+		CHECK( castle.ToString( false ) == "e1g1" );
+
+		const auto promotionBoard = Board( FEN( "4k3/P7/8/8/8/8/8/4K3 w - - 0 1" ) );
+		CHECK( book.Probe( promotionBoard, PROMOTION_KEY, 0 ).ToString( false ) == "a7a8b" );
+	}
+
+	book.Close();
+	std::filesystem::remove( path );
+}
@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/eval/evaluation.h"
+#include "KitsuneEngine/eval/pawn_hash_table.h"
+
+TEST_CASE( "Pawn Structure", "[EvaluationTests]" ) {
+	SECTION( "Passed pawns" ) {
+		// b4 is stopped by the c6 pawn's attack span, h2 by the h6 pawn in front of it. e5 and a3 are free.
+		const auto board = Board( FEN( "4k3/8/2p4p/4P3/1P6/p7/7P/4K3 w - - 0 1" ) );
+		const PawnEntry entry = Evaluation::EvaluatePawns( board );
+		CHECK( entry.m_Passed[WHITE] == Bitboard( Square( "e5" ) ) );
+		CHECK( entry.m_Passed[BLACK] == Bitboard( Square( "a3" ) ) );
+		CHECK( entry.m_AttackSpans[WHITE].GetBit( Square( "d8" ) ) );
+		CHECK( !entry.m_AttackSpans[WHITE].GetBit( Square( "e6" ) ) );
+	}
+
+	SECTION( "Isolated and doubled pawns" ) {
+		// The extra e pawns are passed, but being doubled and isolated outweighs it.
+		const auto healthy = Board( FEN( "4k3/pp6/8/8/8/8/PP6/4K3 w - - 0 1" ) );
+		const auto weak = Board( FEN( "4k3/pp6/8/8/4P3/8/PP2P3/4K3 w - - 0 1" ) );
+		const PackedScore difference = Evaluation::EvaluatePawns( weak ).m_Score - Evaluation::EvaluatePawns( healthy ).
+		                               m_Score;
+		CHECK( GetMiddlegameScore( difference ) < 0 );
+		CHECK( GetEndgameScore( difference ) < 0 );
+	}
+
+	SECTION( "Colors are symmetric" ) {
+		const auto board = Board( FEN( "4k3/pp3p2/7p/2P5/4P3/4P3/8/4K3 w - - 0 1" ) );
+		const auto mirrored = Board( FEN( "4k3/8/4p3/4p3/2p5/7P/PP3P2/4K3 b - - 0 1" ) );
+		CHECK( Evaluation::EvaluatePawns( board ).m_Score == -Evaluation::EvaluatePawns( mirrored ).m_Score );
+	}
+}
+
+TEST_CASE( "Pawn Hash Table", "[EvaluationTests]" ) {
+	const auto table = std::make_unique<PawnHashTable>();
+	auto board = Board( FEN( "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1" ) );
+	const CastleMask castleMask = board.GenerateCastleMask();
+
+	Move moves[MAX_MOVES];
+	const uint8_t count = MoveGenerator( board, castleMask ).GenerateMoves<MoveGenMode::ALL>( moves );
+	for ( uint8_t i = 0; i < count; i++ ) {
+		MoveUndo undo;
+		board.MakeMove( moves[i], castleMask, undo );
+		CHECK( Evaluation::Evaluate( board, *table ) == Evaluation::Evaluate( board ) );
+		board.UnmakeMove( moves[i], undo );
+	}
+
+	// Only pawn moves and captures of pawns change the key, every other move shares the root's entry.
+	const PawnHashStats &stats = table->GetStats();
+	CHECK( stats.m_Probes == count );
+	CHECK( stats.m_Hits > count / 2 );
+
+	table->Clear();
+	CHECK( table->GetStats().m_Probes == 0 );
+}
@@ -1,8 +1,12 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <thread>
+
 #include "KitsuneEngine/core/board.h"
 #include "KitsuneEngine/core/fen.h"
 #include "KitsuneEngine/core/perft.h"
+#include "KitsuneEngine/core/perft_hash_table.h"
 
 static const std::string TEST_CASES[960]{
 	"bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/BQ1BNRKR w HFhf - 2 9 ;D1 21 ;D2 528 ;D3 12189 ;D4 326672 ;D5 8146062 ;D6 227689589",
@@ -984,6 +988,46 @@ TEST_CASE( "FRC Positions", "[PerftTests]" ) {
 	}
 }
 
+// The serial test covers every position, the parallel and hashed ones only check a sample on top.
+static constexpr size_t SAMPLE_STRIDE = 8;
+
+TEST_CASE( "FRC Positions (Parallel)", "[PerftTests]" ) {
+	const uint32_t threadCount = std::max( std::thread::hardware_concurrency(), 2u );
+	for ( size_t i = 0; i < std::size( TEST_CASES ); i += SAMPLE_STRIDE ) {
+		const auto &line = TEST_CASES[i];
+		const auto testCase = Split( line, ';' );
+		const auto fen = FEN( testCase[0] );
+		const auto target = Split( testCase[testCase.size() - 2], ' ' );
+		const auto depth = target[0][1] - '0';
+		const uint64_t expected = std::stoll( target[1] );
+		const auto board = Board( fen );
+		const auto castleRules = board.GenerateCastleMask();
+		DYNAMIC_SECTION( testCase[0] ) {
+			CHECK( ParallelPerft( board, castleRules, depth, true, false, threadCount ) == expected );
+		}
+	}
+}
+
+TEST_CASE( "FRC Positions (Hashed)", "[PerftTests]" ) {
+	const uint32_t threadCount = std::max( std::thread::hardware_concurrency(), 2u );
+
+	// Catch runs the body again for every section, the table is built once and shared by all positions.
+	static auto table = PerftHashTable( 64 );
+	for ( size_t i = 0; i < std::size( TEST_CASES ); i += SAMPLE_STRIDE ) {
+		const auto &line = TEST_CASES[i];
+		const auto testCase = Split( line, ';' );
+		const auto fen = FEN( testCase[0] );
+		const auto target = Split( testCase[testCase.size() - 2], ' ' );
+		const auto depth = target[0][1] - '0';
+		const uint64_t expected = std::stoll( target[1] );
+		const auto board = Board( fen );
+		const auto castleRules = board.GenerateCastleMask();
+		DYNAMIC_SECTION( testCase[0] ) {
+			CHECK( ParallelPerft( board, castleRules, depth, true, false, threadCount, &table ) == expected );
+		}
+	}
+}
+
 static std::vector<std::string> Split( const std::string &str, const char delimiter ) {
 	std::vector<std::string> tokens;
 	size_t start = 0;
@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <vector>
+
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/hash_history.h"
+#include "KitsuneEngine/core/move_gen.h"
+
+// Plays the moves, pushing the hash of every position reached, the starting one included.
+static Board PlayMoves( Board board, HashHistory &history, const std::vector<std::string> &moves ) {
+	history.Push( board.GetHash() );
+	for ( const std::string &text : moves ) {
+		Move legalMoves[MAX_MOVES];
+		const CastleMask castleMask = board.GenerateCastleMask();
+		const uint8_t count = MoveGenerator( board, castleMask ).GenerateMoves<MoveGenMode::ALL>( legalMoves );
+
+		bool found = false;
+		for ( uint8_t i = 0; i < count && !found; i++ ) {
+			if ( legalMoves[i].ToString( false ) == text ) {
+				board.MakeMove( legalMoves[i], castleMask );
+				history.Push( board.GetHash() );
+				found = true;
+			}
+		}
+		REQUIRE( found );
+	}
+
+	return board;
+}
+
+TEST_CASE( "Cuckoo Table", "[HashHistoryTests]" ) {
+	// Every knight, bishop, rook, queen and king move between two squares of an empty board, for both colors.
+	CHECK( HashHistory::GetCuckooMoveCount() == 3668 );
+}
+
+TEST_CASE( "Repetitions", "[HashHistoryTests]" ) {
+	HashHistory history;
+	const std::vector<std::string> cycle{ "g1f3", "g8f6", "f3g1", "f6g8" };
+
+	SECTION( "A position seen once before counts inside the search only" ) {
+		const Board board = PlayMoves( Board(), history, cycle );
+		CHECK( history.IsRepetition( board.GetHalfMoves(), 5 ) );
+		CHECK_FALSE( history.IsRepetition( board.GetHalfMoves(), 4 ) );
+		CHECK_FALSE( history.IsRepetition( board.GetHalfMoves(), 0 ) );
+	}
+
+	SECTION( "The third occurrence counts anywhere" ) {
+		std::vector<std::string> moves = cycle;
+		moves.insert( moves.end(), cycle.begin(), cycle.end() );
+		const Board board = PlayMoves( Board(), history, moves );
+		CHECK( history.IsRepetition( board.GetHalfMoves(), 0 ) );
+	}
+
+	SECTION( "The scan stops at the last pawn move" ) {
+		const Board board = PlayMoves( Board(), history, { "g1f3", "g8f6", "f3g1", "f6g8", "e2e4", "e7e5", "g1f3" } );
+		CHECK_FALSE( history.IsRepetition( board.GetHalfMoves(), 10 ) );
+	}
+}
+
+TEST_CASE( "Upcoming Repetitions", "[HashHistoryTests]" ) {
+	HashHistory history;
+
+	SECTION( "Moving the knight back repeats a position of the search" ) {
+		const Board board = PlayMoves( Board(), history, { "g1f3", "g8f6", "f3g1" } );
+		CHECK( history.HasUpcomingRepetition( board, 4 ) );
+		CHECK_FALSE( history.HasUpcomingRepetition( board, 3 ) );
+	}
+
+	SECTION( "Before the root the position must have repeated already" ) {
+		const Board board = PlayMoves( Board(), history, { "g1f3", "g8f6", "f3g1", "f6g8", "g1f3", "g8f6", "f3g1" } );
+		CHECK( history.HasUpcomingRepetition( board, 0 ) );
+	}
+
+	SECTION( "The opponent's moves must cancel out" ) {
+		const Board board = PlayMoves( Board(), history, { "g1f3", "g8f6", "f3g1", "b8c6" } );
+		CHECK_FALSE( history.HasUpcomingRepetition( board, 10 ) );
+	}
+
+	SECTION( "A blocked way back is no repetition" ) {
+		// The rook went round to a4 while the black king walked a full circle, the way back to a1 crosses a3.
+		const std::vector<std::string> moves{ "f1e1", "e8d8", "a1b1", "d8d7", "b1b4", "d7e7", "b4a4", "e7e8" };
+		const Board open = PlayMoves( Board( FEN( "4k3/8/8/8/8/8/8/R4K2 w - - 0 1" ) ), history, moves );
+		CHECK( history.HasUpcomingRepetition( open, 20 ) );
+
+		history.Clear();
+		const Board blocked = PlayMoves( Board( FEN( "4k3/8/8/8/8/p7/8/R4K2 w - - 0 1" ) ), history, moves );
+		CHECK_FALSE( history.HasUpcomingRepetition( blocked, 20 ) );
+	}
+}
@@ -0,0 +1,130 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/core/move_picker.h"
+
+static const std::string POSITIONS[]{
+	"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+	"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+	"rnbqkb1r/ppppp1pp/7n/4Pp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+	"n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+	"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+	"1rkb1rbn/p1pp1ppp/3np3/1p6/4qP2/3NB3/PPPPPRPP/QRKB3N w Bfb - 0 9",
+};
+
+static std::vector<Move> PickAll( MovePicker &picker ) {
+	std::vector<Move> result;
+	while ( const Move move = picker.Next() ) {
+		result.push_back( move );
+	}
+
+	return result;
+}
+
+static std::vector<Move> GenerateSorted( const Board &board, const CastleMask &castleMask ) {
+	Move moves[MAX_MOVES]{ };
+	const uint8_t count = MoveGenerator( board, castleMask ).GenerateMoves<MoveGenMode::ALL>( moves );
+	std::vector<Move> result( moves, moves + count );
+	std::ranges::sort( result );
+	return result;
+}
+
+TEST_CASE( "Move Picker", "[MovePickerTests]" ) {
+	for ( const auto &position : POSITIONS ) {
+		DYNAMIC_SECTION( position ) {
+			const auto board = Board( FEN( position ) );
+			const auto castleMask = board.GenerateCastleMask();
+			const auto legalMoves = GenerateSorted( board, castleMask );
+
+			auto picker = MovePicker( board, castleMask, Move() );
+			auto picked = PickAll( picker );
+			std::ranges::sort( picked );
+			CHECK( picked == legalMoves );
+
+			for ( const Move hashMove : legalMoves ) {
+				auto hashPicker = MovePicker( board, castleMask, hashMove );
+				auto hashPicked = PickAll( hashPicker );
+				REQUIRE( !hashPicked.empty() );
+				CHECK( hashPicked.front() == hashMove );
+
+				std::ranges::sort( hashPicked );
+				CHECK( hashPicked == legalMoves );
+			}
+
+			auto noisyPicker = MovePicker( board, castleMask, Move(), true );
+			for ( const Move move : PickAll( noisyPicker ) ) {
+				CHECK( ( move.IsCapture() || move.IsPromotion() ) );
+			}
+			CHECK( !noisyPicker.HasGeneratedQuiets() );
+		}
+	}
+}
+
+TEST_CASE( "Move Picker Rejects Illegal Hash Move", "[MovePickerTests]" ) {
+	const auto board = Board( FEN( POSITIONS[0] ) );
+	const auto castleMask = board.GenerateCastleMask();
+
+	// e2e5 and a capture on an empty square are both impossible from the start position.
+	for ( const Move hashMove : { Move( 12, 36, QUIET_MOVE_FLAG ), Move( 12, 21, CAPTURE_FLAG ) } ) {
+		auto picker = MovePicker( board, castleMask, hashMove );
+		const auto picked = PickAll( picker );
+		CHECK( picked.size() == 20 );
+		CHECK( std::ranges::find( picked, hashMove ) == picked.end() );
+	}
+}
+
+TEST_CASE( "Move Picker Orders Captures", "[MovePickerTests]" ) {
+	// The rook on d5 is taken by the pawn before the queen, and both come before the pawn capture on f5.
+	const auto board = Board( FEN( "4k3/8/8/3r1p2/4P3/8/8/3QK3 w - - 0 1" ) );
+	auto picker = MovePicker( board, board.GenerateCastleMask(), Move() );
+
+	CHECK( picker.Next() == Move( 28, 35, CAPTURE_FLAG ) );
+	CHECK( picker.Next() == Move( 3, 35, CAPTURE_FLAG ) );
+	CHECK( picker.Next() == Move( 28, 37, CAPTURE_FLAG ) );
+	CHECK( picker.GetStage() == MovePickerStage::NOISY );
+	CHECK( !picker.HasGeneratedQuiets() );
+}
+
+TEST_CASE( "Quiet Hash Move Check", "[MovePickerTests]" ) {
+	std::vector<std::string> positions( std::begin( POSITIONS ), std::end( POSITIONS ) );
+	positions.insert( positions.end(), {
+		                  "4k3/8/8/8/8/8/4r3/R3K2R w KQ - 0 1",
+		                  "4k3/4r3/8/b7/4P3/8/2N1B3/4K2q w - - 0 1",
+		                  "4k3/8/8/8/1b6/8/3P4/r3K2R w K - 0 1",
+		                  "4k3/8/5n2/8/8/8/8/r3K1NR w K - 0 1",
+	                  } );
+
+	for ( const auto &position : positions ) {
+		DYNAMIC_SECTION( position ) {
+			const auto board = Board( FEN( position ) );
+			const auto castleMask = board.GenerateCastleMask();
+			const auto generator = MoveGenerator( board, castleMask );
+
+			Move quiets[MAX_MOVES];
+			const uint8_t count = generator.GenerateMoves<MoveGenMode::QUIET>( quiets );
+
+			// Every square pair with every quiet flag, most of them impossible.
+			for ( uint8_t from = 0; from < 64; from++ ) {
+				for ( uint8_t to = 0; to < 64; to++ ) {
+					for ( const MoveFlag flag : { QUIET_MOVE_FLAG, DOUBLE_PUSH_FLAG, KING_SIDE_CASTLE_FLAG,
+					                              QUEEN_SIDE_CASTLE_FLAG } ) {
+						const auto move = Move( from, to, flag );
+						const bool generated = std::find( quiets, quiets + count, move ) != quiets + count;
+						CHECK( generator.IsQuietMoveLegal( move ) == generated );
+					}
+				}
+			}
+
+			if ( count > 0 ) {
+				auto picker = MovePicker( board, castleMask, quiets[0] );
+				CHECK( picker.Next() == quiets[0] );
+				CHECK( !picker.HasGeneratedQuiets() );
+			}
+		}
+	}
+}
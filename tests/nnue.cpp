@@ -0,0 +1,132 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/eval/accumulator_stack.h"
+#include "KitsuneEngine/eval/nnue.h"
+#include "KitsuneEngine/search/search_pool.h"
+#include "KitsuneEngine/search/transposition_table.h"
+
+static const std::string NNUE_POSITIONS[]{
+	"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+	"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+	"n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+	"8/5bk1/8/2Pp4/8/1K6/8/8 w - d6 0 1",
+	"bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/BQ1BNRKR w HFhf - 2 9",
+};
+
+// Loads a random network for the test and restores the PSQT evaluation afterwards, the network is global.
+struct RandomNetwork {
+	std::vector<int16_t> m_Data;
+
+	RandomNetwork() : m_Data( NNUE_NETWORK_BYTES / sizeof( int16_t ) ) {
+		std::mt19937 random( 7 );
+		std::uniform_int_distribution weight( -64, 64 );
+		for ( int16_t &value : m_Data ) {
+			value = static_cast<int16_t>(weight( random ));
+		}
+
+		REQUIRE( Nnue::Load( m_Data.data(), NNUE_NETWORK_BYTES ) );
+	}
+
+	~RandomNetwork() {
+		Nnue::Unload();
+	}
+};
+
+TEST_CASE( "NNUE Loading", "[NnueTests]" ) {
+	const RandomNetwork network;
+	CHECK( Nnue::IsLoaded() );
+
+	std::vector<int16_t> data = network.m_Data;
+	CHECK( !Nnue::Load( data.data(), NNUE_NETWORK_BYTES - 2 ) );
+	CHECK( !Nnue::Load( "missing.nnue" ) );
+
+	// An output weight this large overflows the int16 product in the SIMD kernels.
+	data[( NNUE_KING_BUCKETS * NNUE_INPUT_SIZE + 1 ) * NNUE_HIDDEN_SIZE] = 200;
+	CHECK( !Nnue::Load( data.data(), NNUE_NETWORK_BYTES ) );
+	CHECK( Nnue::IsLoaded() );
+}
+
+// Evaluates only the leaves, or every node, so both the chained deltas and the Finny table refreshes are exercised.
+static void CheckAccumulatorStack( Board &board, const CastleMask &castleMask, AccumulatorStack &stack,
+                                   const uint8_t depth, const bool evaluateInterior ) {
+	if ( depth == 0 || evaluateInterior ) {
+		CHECK( stack.Evaluate( board ) == Nnue::Evaluate( board ) );
+	}
+	if ( depth == 0 ) {
+		return;
+	}
+
+	Move moves[MAX_MOVES];
+	const uint8_t count = MoveGenerator( board, castleMask ).GenerateMoves<MoveGenMode::ALL>( moves );
+	for ( uint8_t i = 0; i < count; i++ ) {
+		MoveUndo undo;
+		board.MakeMove( moves[i], castleMask, undo, &stack.Push() );
+		CheckAccumulatorStack( board, castleMask, stack, depth - 1, evaluateInterior );
+		board.UnmakeMove( moves[i], undo );
+		stack.Pop();
+	}
+}
+
+TEST_CASE( "NNUE Accumulator Stack Matches Refresh", "[NnueTests]" ) {
+	const RandomNetwork network;
+	const auto stack = std::make_unique<AccumulatorStack>();
+
+	for ( const auto &fen : NNUE_POSITIONS ) {
+		auto board = Board( FEN( fen ) );
+		const CastleMask castleMask = board.GenerateCastleMask();
+
+		for ( const bool evaluateInterior : { false, true } ) {
+			stack->Reset();
+			CheckAccumulatorStack( board, castleMask, *stack, 2, evaluateInterior );
+		}
+	}
+
+	CHECK( stack->GetStats().m_Refreshes > 0 );
+}
+
+TEST_CASE( "NNUE Kernels Agree", "[NnueTests]" ) {
+	const RandomNetwork network;
+	const SimdLevel selected = Nnue::GetSimdLevel();
+
+	for ( const auto &fen : NNUE_POSITIONS ) {
+		const auto board = Board( FEN( fen ) );
+
+		REQUIRE( Nnue::SetSimdLevel( SimdLevel::SCALAR ) );
+		const int32_t expected = Nnue::Evaluate( board );
+
+		for ( const SimdLevel level : { SimdLevel::AVX2, SimdLevel::AVX512 } ) {
+			if ( Nnue::SetSimdLevel( level ) ) {
+				CHECK( Nnue::Evaluate( board ) == expected );
+			}
+		}
+	}
+
+	Nnue::SetSimdLevel( selected );
+}
+
+// Searched the way bench does, with a fresh table for every position.
+static uint64_t CountSearchNodes( const SearchLimits &limits ) {
+	uint64_t nodes = 0;
+	for ( const auto &position : NNUE_POSITIONS ) {
+		auto table = TranspositionTable( 4 );
+		auto pool = SearchPool( table, 1 );
+		nodes += pool.Run( Board( FEN( position ) ), limits ).m_Nodes;
+	}
+
+	return nodes;
+}
+
+TEST_CASE( "Bench Ignores The Network", "[NnueTests]" ) {
+	const SearchLimits benchLimits{ .m_Depth = 5, .m_UseTablebases = false, .m_UseNetwork = false };
+	const uint64_t withoutNetwork = CountSearchNodes( benchLimits );
+
+	const RandomNetwork network;
+	CHECK( CountSearchNodes( benchLimits ) == withoutNetwork );
+	CHECK( CountSearchNodes( { .m_Depth = 5 } ) != withoutNetwork );
+}
@@ -0,0 +1,133 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/search/search.h"
+#include "KitsuneEngine/search/search_pool.h"
+#include "KitsuneEngine/search/transposition_table.h"
+
+static SearchResult RunSearch( const std::string &fen, const SearchLimits &limits, const uint32_t threads = 1 ) {
+	auto table = TranspositionTable( 4 );
+	auto pool = SearchPool( table, threads );
+	return pool.Run( Board( FEN( fen ) ), limits );
+}
+
+TEST_CASE( "Search Finds Mates", "[SearchTests]" ) {
+	SECTION( "Back rank mate in one" ) {
+		const auto result = RunSearch( "6k1/5ppp/8/8/8/8/8/R5K1 w - - 0 1", { .m_Depth = 4 } );
+		CHECK( result.m_BestMove == Move( 0, 56, QUIET_MOVE_FLAG ) );
+		CHECK( result.m_Score == MATE_SCORE - 1 );
+		CHECK( Search::ScoreToString( result.m_Score ) == "mate 1" );
+	}
+
+	SECTION( "Mate in two" ) {
+		const auto result = RunSearch( "kbK5/pp6/1P6/8/8/8/8/R7 w - - 0 1", { .m_Depth = 6 } );
+		CHECK( result.m_BestMove == Move( 0, 40, QUIET_MOVE_FLAG ) );
+		CHECK( Search::ScoreToString( result.m_Score ) == "mate 2" );
+	}
+
+	SECTION( "Mated side reports a negative mate" ) {
+		const auto result = RunSearch( "7k/8/8/8/8/8/5PPP/r5K1 w - - 0 1", { .m_Depth = 3 } );
+		CHECK( !result.m_BestMove );
+		CHECK( result.m_Score == -MATE_SCORE );
+	}
+}
+
+TEST_CASE( "Search Handles Terminal Roots", "[SearchTests]" ) {
+	const auto result = RunSearch( "7k/5Q2/6K1/8/8/8/8/8 b - - 0 1", { .m_Depth = 5 } );
+	CHECK( !result.m_BestMove );
+	CHECK( result.m_Score == DRAW_SCORE );
+}
+
+TEST_CASE( "Search Wins Material", "[SearchTests]" ) {
+	// The queen on d5 is en prise to the e4 pawn.
+	const auto result = RunSearch( "4k3/8/8/3q4/4P3/8/8/4K3 w - - 0 1", { .m_Depth = 3 } );
+	CHECK( result.m_BestMove == Move( 28, 35, CAPTURE_FLAG ) );
+	CHECK( result.m_Score > 0 );
+}
+
+TEST_CASE( "Search Respects Limits", "[SearchTests]" ) {
+	const std::string fen = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+
+	SECTION( "Node limit is deterministic" ) {
+		const auto first = RunSearch( fen, { .m_Nodes = 20000 } );
+		const auto second = RunSearch( fen, { .m_Nodes = 20000 } );
+		CHECK( first.m_BestMove );
+		CHECK( first.m_BestMove == second.m_BestMove );
+		CHECK( first.m_Depth == second.m_Depth );
+		CHECK( first.m_Nodes == second.m_Nodes );
+		CHECK( first.m_Nodes <= 20000 );
+	}
+
+	SECTION( "Node limit counts every thread" ) {
+		// Each thread checks the total every 1024 of its own nodes.
+		const auto result = RunSearch( fen, { .m_Nodes = 100000 }, 4 );
+		CHECK( result.m_BestMove );
+		CHECK( result.m_Nodes >= 100000 );
+		CHECK( result.m_Nodes < 100000 + 4 * 4096 );
+	}
+
+	SECTION( "Time limit" ) {
+		const auto result = RunSearch( fen, { .m_Milliseconds = 50 } );
+		CHECK( result.m_BestMove );
+		CHECK( result.m_Milliseconds < 1000 );
+	}
+}
+
+TEST_CASE( "Lazy SMP Search", "[SearchTests]" ) {
+	SECTION( "Finds the same mate with helpers" ) {
+		const auto result = RunSearch( "kbK5/pp6/1P6/8/8/8/8/R7 w - - 0 1", { .m_Depth = 6 }, 4 );
+		CHECK( result.m_BestMove == Move( 0, 40, QUIET_MOVE_FLAG ) );
+		CHECK( Search::ScoreToString( result.m_Score ) == "mate 2" );
+	}
+
+	SECTION( "Stop ends unbounded helpers" ) {
+		auto table = TranspositionTable( 4 );
+		auto pool = SearchPool( table, 3 );
+		const auto board = Board( FEN( "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1" ) );
+
+		uint64_t reportedNodes = 0;
+		pool.Start( board, { .m_Milliseconds = 50 }, [&reportedNodes]( const SearchInfo &info ) {
+			reportedNodes = info.m_Nodes;
+		} );
+		const auto result = pool.Wait();
+
+		CHECK( result.m_BestMove );
+		CHECK( result.m_Nodes >= reportedNodes );
+		CHECK( result.m_Nodes == pool.GetNodes() );
+	}
+}
+
+TEST_CASE( "Search Claims Repetitions", "[SearchTests]" ) {
+	// A queen down, white can only hope for a repetition. The kings have been shuffling, so Kg1 repeats a third time.
+	auto board = Board( FEN( "6k1/8/8/8/8/8/q7/5N1K w - - 0 1" ) );
+	std::vector<uint64_t> history;
+	for ( const std::string text : { "h1g1", "g8h8", "g1h1", "h8g8", "h1g1", "g8h8", "g1h1", "h8g8" } ) {
+		Move moves[MAX_MOVES];
+		const CastleMask castleMask = board.GenerateCastleMask();
+		const uint8_t count = MoveGenerator( board, castleMask ).GenerateMoves<MoveGenMode::ALL>( moves );
+		const Move *move = std::find_if( moves, moves + count, [&text]( const Move candidate ) {
+			return candidate.ToString( false ) == text;
+		} );
+		REQUIRE( move != moves + count );
+
+		history.push_back( board.GetHash() );
+		board.MakeMove( *move, castleMask );
+	}
+
+	auto table = TranspositionTable( 4 );
+	auto pool = SearchPool( table, 1 );
+
+	const auto withoutHistory = pool.Run( board, { .m_Depth = 6 } );
+	CHECK( withoutHistory.m_Score < -300 );
+
+	table.Clear();
+	const auto withHistory = pool.Run( board, { .m_Depth = 6 }, nullptr, history );
+	CHECK( withHistory.m_BestMove.ToString( false ) == "h1g1" );
+	CHECK( withHistory.m_Score == DRAW_SCORE );
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "KitsuneEngine/core/board.h"
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+
+static const std::string POSITIONS[]{
+	"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+	"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+	"rnbqkb1r/ppppp1pp/7n/4Pp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+	"n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+	"1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - - 0 1",
+	"bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/BQ1BNRKR w HFhf - 2 9",
+};
+
+TEST_CASE( "Static Exchange Evaluation", "[SeeTests]" ) {
+	struct SeeCase {
+		std::string m_Fen;
+		Move m_Move;
+		int32_t m_Score;
+	};
+
+	const SeeCase cases[]{
+		// Undefended pawn.
+		{ "1k1r4/1pp4p/p7/4p3/8/P5P1/1PP4P/2K1R3 w - - 0 1", Move( 4, 36, CAPTURE_FLAG ), 100 },
+		// Queen takes a pawn defended by a pawn.
+		{ "4k3/8/2p5/3p4/8/8/8/3QK3 w - - 0 1", Move( 3, 35, CAPTURE_FLAG ), -800 },
+		// The rook on d1 is an x-ray behind the one on d2, so black gains nothing by recapturing.
+		{ "4k3/3r4/8/3p4/8/8/3R4/3RK3 w - - 0 1", Move( 11, 35, CAPTURE_FLAG ), 100 },
+		// The king may take the rook, unless the bishop covers f7.
+		{ "6k1/5p2/8/8/8/8/8/4KR2 w - - 0 1", Move( 5, 53, CAPTURE_FLAG ), -400 },
+		{ "6k1/5p2/8/8/8/1B6/8/4KR2 w - - 0 1", Move( 5, 53, CAPTURE_FLAG ), 100 },
+		{ "4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1", Move( 36, 43, EN_PASSANT_FLAG ), 100 },
+		{ "4k3/P7/8/8/8/8/8/4K3 w - - 0 1", Move( 48, 56, QUEEN_PROMOTION_FLAG ), 800 },
+		{ "1r2k3/P7/8/8/8/8/8/4K3 w - - 0 1", Move( 48, 56, QUEEN_PROMOTION_FLAG ), -100 },
+		{ "1r2k3/P7/8/8/8/8/8/4K3 w - - 0 1", Move( 48, 57, QUEEN_PROMOTION_CAPTURE_FLAG ), 1300 },
+		{ "4k3/8/8/8/8/8/8/R3K3 w Q - 0 1", Move( 4, 2, QUEEN_SIDE_CASTLE_FLAG ), 0 },
+	};
+
+	for ( const auto &[fen, move, score] : cases ) {
+		DYNAMIC_SECTION( fen << ' ' << move.ToString( false ) ) {
+			const auto board = Board( FEN( fen ) );
+			CHECK( board.See( move ) == score );
+			CHECK( board.SeeGe( move, score ) );
+			CHECK( !board.SeeGe( move, score + 1 ) );
+		}
+	}
+}
+
+// The early exits of the threshold form must never change its answer.
+TEST_CASE( "SeeGe Matches See", "[SeeTests]" ) {
+	for ( const auto &position : POSITIONS ) {
+		DYNAMIC_SECTION( position ) {
+			const auto board = Board( FEN( position ) );
+
+			Move moves[MAX_MOVES];
+			const uint8_t count = MoveGenerator( board, board.GenerateCastleMask() ).GenerateMoves<MoveGenMode::ALL>( moves );
+			for ( uint8_t i = 0; i < count; i++ ) {
+				const int32_t score = board.See( moves[i] );
+				for ( const int32_t threshold : { -1300, -900, -500, -200, -100, -1, 0, 1, 100, 200, 500, 900 } ) {
+					if ( board.SeeGe( moves[i], threshold ) != ( score >= threshold ) ) {
+						FAIL( moves[i].ToString( false ) << " scores " << score << ", threshold " << threshold );
+					}
+				}
+			}
+		}
+	}
+}
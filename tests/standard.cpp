@@ -1,7 +1,11 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <thread>
+
 #include "KitsuneEngine/core/board.h"
 #include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
 #include "KitsuneEngine/core/perft.h"
 
 static const std::string TEST_CASES[128]{
@@ -135,6 +139,16 @@ static const std::string TEST_CASES[128]{
 	"rnbqkb1r/ppppp1pp/7n/4Pp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3 ;D5 11139762"
 };
 
+static const std::string EN_PASSANT_CASES[7]{
+	"8/8/1k6/2b5/2pP4/8/5K2/8 b - d3 0 1 ;D6 1440467",
+	"8/5bk1/8/2Pp4/8/1K6/8/8 w - d6 0 1 ;D6 824064",
+	"8/8/1k6/8/2pP4/8/5BK1/8 b - d3 0 1 ;D6 824064",
+	"3k4/3p4/8/K1P4r/8/8/8/8 b - - 0 1 ;D6 1134888",
+	"8/8/4k3/8/2p5/8/B2P2K1/8 w - - 0 1 ;D6 1015133",
+	"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1 ;D4 43238 ;D5 674624 ;D6 11030083",
+	"rnbqkb1r/ppppp1pp/7n/4Pp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3 ;D5 11139762",
+};
+
 static std::vector<std::string> Split( const std::string &str, char delimiter );
 
 TEST_CASE( "Standard Positions", "[PerftTests]" ) {
@@ -152,6 +166,50 @@ TEST_CASE( "Standard Positions", "[PerftTests]" ) {
 	}
 }
 
+TEST_CASE( "En Passant Positions", "[PerftTests]" ) {
+	for ( const auto &line : EN_PASSANT_CASES ) {
+		const auto testCase = Split( line, ';' );
+		const auto target = Split( testCase[testCase.size() - 1], ' ' );
+		const auto depth = target[0][1] - '0';
+		const uint64_t expected = std::stoll( target[1] );
+		const auto board = Board( FEN( testCase[0] ) );
+		const auto castleRules = board.GenerateCastleMask();
+		DYNAMIC_SECTION( testCase[0] ) {
+			CHECK( Perft( board, castleRules, depth, true, false, true ) == expected );
+		}
+	}
+}
+
+TEST_CASE( "Standard Positions (Parallel)", "[PerftTests]" ) {
+	const uint32_t threadCount = std::max( std::thread::hardware_concurrency(), 2u );
+	for ( const auto &line : TEST_CASES ) {
+		const auto testCase = Split( line, ';' );
+		const auto fen = FEN( testCase[0] );
+		const auto target = Split( testCase[testCase.size() - 1], ' ' );
+		const auto depth = target[0][1] - '0';
+		const uint64_t expected = std::stoll( target[1] );
+		const auto board = Board( fen );
+		const auto castleRules = board.GenerateCastleMask();
+		DYNAMIC_SECTION( testCase[0] ) {
+			CHECK( ParallelPerft( board, castleRules, depth, true, false, threadCount ) == expected );
+		}
+	}
+}
+
+TEST_CASE( "Move Counting", "[PerftTests]" ) {
+	for ( const auto &line : TEST_CASES ) {
+		const auto testCase = Split( line, ';' );
+		const auto board = Board( FEN( testCase[0] ) );
+		const auto moveGenerator = MoveGenerator( board, board.GenerateCastleMask() );
+		Move moves[MAX_MOVES]{ };
+		DYNAMIC_SECTION( testCase[0] ) {
+			CHECK( moveGenerator.CountMoves<MoveGenMode::ALL>() == moveGenerator.GenerateMoves<MoveGenMode::ALL>( moves ) );
+			CHECK( moveGenerator.CountMoves<MoveGenMode::NOISY>() == moveGenerator.GenerateMoves<MoveGenMode::NOISY>( moves ) );
+			CHECK( moveGenerator.CountMoves<MoveGenMode::QUIET>() == moveGenerator.GenerateMoves<MoveGenMode::QUIET>( moves ) );
+		}
+	}
+}
+
 static std::vector<std::string> Split( const std::string &str, const char delimiter ) {
 	std::vector<std::string> tokens;
 	size_t start = 0;
@@ -0,0 +1,158 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "KitsuneEngine/core/fen.h"
+#include "KitsuneEngine/core/move_gen.h"
+#include "KitsuneEngine/tablebase/syzygy.h"
+
+// The tables are not part of the repository. Put at least the 3 and 4 piece ones here to check the probes.
+static const std::string SYZYGY_DIRECTORY = "syzygy";
+
+static std::filesystem::path MakeTempDirectory( const std::string &name ) {
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+	std::filesystem::remove_all( path );
+	std::filesystem::create_directories( path );
+	return path;
+}
+
+static void WriteFile( const std::filesystem::path &path, const std::string &content ) {
+	std::ofstream file( path, std::ios::binary | std::ios::trunc );
+	file << content;
+}
+
+static WdlScore ProbeWdl( const std::string &fen ) {
+	WdlScore score = WdlScore::DRAW;
+	REQUIRE( Syzygy::ProbeWdl( Board( FEN( fen ) ), score ) );
+	return score;
+}
+
+TEST_CASE( "Syzygy Without Tables", "[SyzygyTests]" ) {
+	Syzygy::Free();
+
+	CHECK( Syzygy::Init( ( std::filesystem::temp_directory_path() / "kitsune_no_such_directory" ).string() ) == 0 );
+	CHECK( Syzygy::GetMaxPieces() == 0 );
+
+	const auto board = Board( FEN( "8/8/8/4k3/8/8/8/4K2Q w - - 0 1" ) );
+	CHECK_FALSE( Syzygy::CanProbe( board ) );
+
+	WdlScore score;
+	CHECK_FALSE( Syzygy::ProbeWdl( board, score ) );
+
+	Move move;
+	CHECK_FALSE( Syzygy::ProbeRoot( board, move, score ) );
+}
+
+TEST_CASE( "Syzygy Table Registration", "[SyzygyTests]" ) {
+	const std::filesystem::path directory = MakeTempDirectory( "kitsune_syzygy_test" );
+
+	// Only the names are read by Init; the files are checked when first probed.
+	WriteFile( directory / "KQvK.rtbw", "not a table" );
+	WriteFile( directory / "KQvK.rtbz", "not a table" );
+	WriteFile( directory / "KRvKP.rtbw", std::string( "\x71\xE8\x23\x5D\x03", 5 ) );
+	WriteFile( directory / "notes.txt", "KRRvK" );
+	WriteFile( directory / "KXvK.rtbw", "" );
+
+	Syzygy::ResetStats();
+	CHECK( Syzygy::Init( directory.string() ) == 2 );
+	CHECK( Syzygy::GetMaxPieces() == 4 );
+
+	SECTION( "Probing needs no castling rights and few enough pieces" ) {
+		CHECK( Syzygy::CanProbe( Board( FEN( "8/8/8/4k3/8/8/8/4K2Q w - - 0 1" ) ) ) );
+		CHECK_FALSE( Syzygy::CanProbe( Board( FEN( "8/8/8/4k3/8/8/8/4K2R w K - 0 1" ) ) ) );
+		CHECK_FALSE( Syzygy::CanProbe( Board( FEN( "8/8/8/4k3/8/8/8/2QQK2Q w - - 0 1" ) ) ) );
+	}
+
+	SECTION( "Bare kings are a draw without any table" ) {
+		WdlScore score;
+		REQUIRE( Syzygy::ProbeWdl( Board( FEN( "8/8/8/4k3/8/8/8/4K3 w - - 0 1" ) ), score ) );
+		CHECK( score == WdlScore::DRAW );
+	}
+
+	SECTION( "A root probe counts once however many moves it scores" ) {
+		Move move;
+		WdlScore score;
+		REQUIRE( Syzygy::ProbeRoot( Board( FEN( "8/8/8/4k3/8/8/8/4K3 w - - 0 1" ) ), move, score ) );
+		CHECK( score == WdlScore::DRAW );
+
+		const SyzygyStats stats = Syzygy::GetStats();
+		CHECK( stats.m_WdlProbes == 0 );
+		CHECK( stats.m_DtzProbes == 1 );
+		CHECK( stats.m_DtzHits == 1 );
+	}
+
+	SECTION( "Broken files fail the probe instead of being read" ) {
+		WdlScore score;
+		CHECK_FALSE( Syzygy::ProbeWdl( Board( FEN( "8/8/8/4k3/8/8/8/4K2Q w - - 0 1" ) ), score ) );
+		CHECK_FALSE( Syzygy::ProbeWdl( Board( FEN( "8/8/8/4k3/8/8/8/4K2Q b - - 0 1" ) ), score ) );
+		CHECK_FALSE( Syzygy::ProbeWdl( Board( FEN( "8/8/8/4k3/4p3/8/8/4K2R w - - 0 1" ) ), score ) );
+
+		int32_t dtz;
+		CHECK_FALSE( Syzygy::ProbeDtz( Board( FEN( "8/8/8/4k3/8/8/8/4K2Q w - - 0 1" ) ), dtz ) );
+
+		const SyzygyStats stats = Syzygy::GetStats();
+		CHECK( stats.m_WdlProbes == 3 );
+		CHECK( stats.m_WdlHits == 0 );
+		CHECK( stats.m_DtzProbes == 1 );
+	}
+
+	Syzygy::Free();
+	CHECK( Syzygy::GetMaxPieces() == 0 );
+	std::filesystem::remove_all( directory );
+}
+
+TEST_CASE( "Syzygy Probes", "[SyzygyTests]" ) {
+	if ( !std::filesystem::is_directory( SYZYGY_DIRECTORY ) || Syzygy::Init( SYZYGY_DIRECTORY ) == 0 ) {
+		SKIP( "No Syzygy tables in " << SYZYGY_DIRECTORY );
+	}
+
+	if ( Syzygy::GetMaxPieces() < 4 ) {
+		Syzygy::Free();
+		SKIP( "The 4 piece tables are needed" );
+	}
+
+	SECTION( "WDL" ) {
+		CHECK( ProbeWdl( "8/8/8/4k3/8/8/8/4K2Q w - - 0 1" ) == WdlScore::WIN );
+		CHECK( ProbeWdl( "8/8/8/4k3/8/8/8/4K2Q b - - 0 1" ) == WdlScore::LOSS );
+		CHECK( ProbeWdl( "8/8/8/4k3/8/8/8/4K2q w - - 0 1" ) == WdlScore::LOSS );
+		CHECK( ProbeWdl( "8/8/8/2r1k3/8/8/8/4K2R w - - 0 1" ) == WdlScore::DRAW );
+		CHECK( ProbeWdl( "8/8/8/4k3/8/8/8/4KN2 w - - 0 1" ) == WdlScore::DRAW );
+
+		// The side to move takes the queen.
+		CHECK( ProbeWdl( "8/8/8/8/8/8/2k5/KQ6 b - - 0 1" ) == WdlScore::DRAW );
+	}
+
+	SECTION( "Colors mirrored give the same result" ) {
+		CHECK( ProbeWdl( "8/4P3/8/8/8/2k5/8/4K3 w - - 0 1" ) == ProbeWdl( "4k3/8/2K5/8/8/8/4p3/8 b - - 0 1" ) );
+		CHECK( ProbeWdl( "8/8/8/8/1k6/8/1P6/1K6 b - - 0 1" ) == ProbeWdl( "1k6/1p6/8/1K6/8/8/8/8 w - - 0 1" ) );
+	}
+
+	SECTION( "DTZ agrees with WDL" ) {
+		for ( const std::string fen : { "8/8/8/4k3/8/8/8/4K2Q w - - 0 1", "8/8/8/4k3/8/8/8/4K2Q b - - 0 1",
+		                                "8/8/8/2r1k3/8/8/8/4K2R w - - 0 1", "8/8/3k4/8/8/3K4/3P4/8 w - - 0 1" } ) {
+			const auto board = Board( FEN( fen ) );
+			WdlScore score;
+			int32_t dtz;
+			REQUIRE( Syzygy::ProbeWdl( board, score ) );
+			REQUIRE( Syzygy::ProbeDtz( board, dtz ) );
+			CHECK( ( score > WdlScore::DRAW ) == ( dtz > 0 ) );
+			CHECK( ( score < WdlScore::DRAW ) == ( dtz < 0 ) );
+		}
+	}
+
+	SECTION( "Root move keeps the win" ) {
+		const auto board = Board( FEN( "8/8/8/4k3/8/8/8/4K2Q w - - 0 1" ) );
+		Move move;
+		WdlScore score;
+		REQUIRE( Syzygy::ProbeRoot( board, move, score ) );
+		CHECK( score == WdlScore::WIN );
+
+		Board child = board;
+		child.MakeMove( move, board.GenerateCastleMask() );
+		CHECK( ProbeWdl( child.ToFEN() ) == WdlScore::LOSS );
+	}
+
+	Syzygy::Free();
+}
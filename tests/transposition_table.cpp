@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "KitsuneEngine/search/search.h"
+#include "KitsuneEngine/search/transposition_table.h"
+
+TEST_CASE( "Transposition Table Store And Probe", "[TranspositionTableTests]" ) {
+	auto table = TranspositionTable( 1 );
+	const uint64_t hash = 0x123456789ABCDEF0ull;
+	const Move move = Move( 12, 28, DOUBLE_PUSH_FLAG );
+
+	TTData data{ };
+	CHECK( !table.Probe( hash, 0, data ) );
+
+	table.Store( hash, move, -150, 7, TTBound::LOWER, 0 );
+	REQUIRE( table.Probe( hash, 0, data ) );
+	CHECK( data.m_Move == move );
+	CHECK( data.m_Score == -150 );
+	CHECK( data.m_Depth == 7 );
+	CHECK( data.m_Bound == TTBound::LOWER );
+
+	SECTION( "Store without a move keeps the old one" ) {
+		table.Store( hash, Move(), 30, 8, TTBound::UPPER, 0 );
+		REQUIRE( table.Probe( hash, 0, data ) );
+		CHECK( data.m_Move == move );
+		CHECK( data.m_Score == 30 );
+	}
+
+	SECTION( "Clear" ) {
+		table.Clear( 4 );
+		CHECK( !table.Probe( hash, 0, data ) );
+		CHECK( table.GetHashfull() == 0 );
+	}
+}
+
+TEST_CASE( "Transposition Table Mate Scores", "[TranspositionTableTests]" ) {
+	auto table = TranspositionTable( 1 );
+	const uint64_t hash = 0xFEDCBA9876543210ull;
+
+	// Mate in 3 plies seen from ply 5 is mate in 8 plies from the root; probed at ply 2 it is mate in 5.
+	table.Store( hash, Move(), MATE_SCORE - 8, 4, TTBound::EXACT, 5 );
+
+	TTData data{ };
+	REQUIRE( table.Probe( hash, 2, data ) );
+	CHECK( data.m_Score == MATE_SCORE - 5 );
+
+	table.Store( hash, Move(), -MATE_SCORE + 8, 4, TTBound::EXACT, 5 );
+	REQUIRE( table.Probe( hash, 2, data ) );
+	CHECK( data.m_Score == -MATE_SCORE + 5 );
+}
+
+TEST_CASE( "Transposition Table Tablebase Scores", "[TranspositionTableTests]" ) {
+	auto table = TranspositionTable( 1 );
+	const uint64_t hash = 0x0123456789ABCDEFull;
+
+	// A tablebase win probed at ply 6 is scored from the root, so it is worth more when reached at ply 3.
+	table.Store( hash, Move(), TB_WIN_SCORE - 6, 4, TTBound::EXACT, 6 );
+
+	TTData data{ };
+	REQUIRE( table.Probe( hash, 3, data ) );
+	CHECK( data.m_Score == TB_WIN_SCORE - 3 );
+
+	table.Store( hash, Move(), -TB_WIN_SCORE + 6, 4, TTBound::EXACT, 6 );
+	REQUIRE( table.Probe( hash, 3, data ) );
+	CHECK( data.m_Score == -TB_WIN_SCORE + 3 );
+
+	// Evaluations are stored as they are.
+	table.Store( hash, Move(), EVAL_BOUND, 4, TTBound::EXACT, 6 );
+	REQUIRE( table.Probe( hash, 3, data ) );
+	CHECK( data.m_Score == EVAL_BOUND );
+}
+
+TEST_CASE( "Transposition Table Hashfull", "[TranspositionTableTests]" ) {
+	auto table = TranspositionTable( 1 );
+	for ( uint64_t i = 0; i < table.GetSizeInBytes() / 16; i++ ) {
+		table.Store( i * 0x9E3779B97F4A7C15ull, Move(), 0, 1, TTBound::EXACT, 0 );
+	}
+
+	CHECK( table.GetHashfull() > 500 );
+
+	table.NewSearch();
+	CHECK( table.GetHashfull() == 0 );
+}
+
+TEST_CASE( "Transposition Table Failed Resize", "[TranspositionTableTests]" ) {
+	auto table = TranspositionTable( 1 );
+	const uint64_t size = table.GetSizeInBytes();
+
+	// Far more than any machine has, the previous size is kept.
+	CHECK( !table.Resize( UINT32_MAX ) );
+	CHECK( table.GetSizeInBytes() == size );
+
+	const uint64_t hash = 0x0F1E2D3C4B5A6978ull;
+	TTData data{ };
+	table.Store( hash, Move( 12, 28, DOUBLE_PUSH_FLAG ), 25, 3, TTBound::EXACT, 0 );
+	CHECK( table.Probe( hash, 0, data ) );
+
+	CHECK( table.Resize( 2 ) );
+	CHECK( table.GetSizeInBytes() == 2 * 1024 * 1024 );
+}